@@ -33,6 +33,185 @@
 
 /* --------------------------------------------------------------------------------------------- */
 
+#ifdef  USE_EVENTS
+
+static
+tsk_t MAIN = { { 0, 0 }, ID_RIP, 0, NULL, &MAIN, NULL, NULL, &MAIN };
+
+sys_t sys = { &MAIN, 0, false, true, { 0, INFINITE } };
+
+/* -------------------------------------------------------------------------- */
+
+__attribute__((weak))
+void sys_idle( cnt_t delay ) { (void) delay; } // user function - called when there is no ready task
+
+/* -------------------------------------------------------------------------- */
+
+void sys_wakeup( const void *obj ) // NULL: only request the update of the ready list
+{
+	tsk_t *tsk;
+
+	if (obj != NULL)
+		for (tsk = MAIN.next; tsk != &MAIN; tsk = tsk->next)
+			if (tsk->event == obj)
+				tsk->event = NULL;
+
+	sys.pending = true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+bool priv_tsk_waiting( tsk_t *tsk )
+{
+	return tsk->id != ID_RDY || tsk->event != NULL || tsk->timer != NULL || tsk->tmr.delay > 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+cnt_t priv_tmr_remaining( tmr_t *tmr, cnt_t now )
+{
+	if (tmr->delay == INFINITE)
+		return INFINITE;
+
+	return tmr->delay - (now - tmr->start);
+}
+
+/* -------------------------------------------------------------------------- */
+// fold the deadline of the timer (tmr) awaited by the parked task into the system timer
+
+static
+void priv_sys_timer( tmr_t *tmr )
+{
+	cnt_t now = sys_time();
+
+	if (tmr_expired(tmr))
+		sys.pending = true;
+	else
+	if (sys.timer.delay == INFINITE || (!tmr_expired(&sys.timer) &&
+	    priv_tmr_remaining(&sys.timer, now) > priv_tmr_remaining(tmr, now)))
+	{
+		sys.timer.start = now;
+		sys.timer.delay = priv_tmr_remaining(tmr, now);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_sys_update( void )
+{
+	tsk_t *tsk;
+	cnt_t  now;
+	cnt_t  delay;
+
+	if (!sys.pending && (sys.timer.delay == INFINITE || !tmr_expired(&sys.timer)) && MAIN.ready != &MAIN)
+		return;
+
+	sys.pending = false;
+	now = sys_time();
+	delay = INFINITE;
+
+	for (tsk = MAIN.next; tsk != &MAIN; tsk = tsk->next)
+	{
+		if (tsk->ready != NULL || tsk->id != ID_RDY || tsk->event != NULL)
+			continue;
+
+		if (tsk->timer != NULL)
+		{
+			if (!tmr_expired(tsk->timer))
+			{
+				cnt_t remaining = priv_tmr_remaining(tsk->timer, now);
+				if (delay == INFINITE || delay > remaining) delay = remaining;
+				continue;
+			}
+
+			tsk->timer = NULL;
+		}
+
+		if (tsk->tmr.delay > 0)
+		{
+			if (!tmr_expired(&tsk->tmr))
+			{
+				cnt_t remaining = priv_tmr_remaining(&tsk->tmr, now);
+				if (delay == INFINITE || delay > remaining) delay = remaining;
+				continue;
+			}
+
+			tsk->tmr.start += tsk->tmr.delay;
+			tsk->tmr.delay = 0;
+		}
+
+		tsk->ready = MAIN.ready;
+		MAIN.ready = tsk;
+	}
+
+	sys.timer.start = now;
+	sys.timer.delay = delay;
+
+	if (MAIN.ready == &MAIN && !sys.pending)
+		sys_idle(delay);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void sys_start( void )
+{
+	tsk_t *current = sys.current;
+	tsk_t *prev = current;
+
+	sys_init();
+
+	for (;;)
+	{
+		if (current->id != ID_RDY)
+			sys_resume();
+
+		if (!sys.suspended)
+		{
+			if (current != &MAIN && priv_tsk_waiting(current))
+			{
+				prev->ready = current->ready;
+				current->ready = NULL;
+				// without it the scheduler would not check the task again until another event
+				if (current->timer != NULL)
+					priv_sys_timer(current->timer);
+				if (current->tmr.delay > 0)
+					priv_sys_timer(&current->tmr);
+			}
+			else
+			{
+				prev = current;
+			}
+
+			sys.current = current = prev->ready;
+		}
+
+		if (current == &MAIN)
+		{
+			priv_sys_update();
+			continue;
+		}
+
+		if (current->id == ID_RDY)
+		{
+			if (current->tmr.delay > 0)
+			{
+				if (!tmr_expired(&current->tmr))
+					continue;
+
+				current->tmr.start += current->tmr.delay;
+				current->tmr.delay = 0;
+			}
+
+			current->function();
+		}
+	}
+}
+
+#else//!USE_EVENTS
+
 static
 tsk_t MAIN = { { 0, 0 }, ID_RIP, 0, NULL, &MAIN };
 
@@ -70,6 +249,8 @@ void sys_start( void )
 	}
 }
 
+#endif//USE_EVENTS
+
 /* --------------------------------------------------------------------------------------------- */
 
 void tsk_start( tsk_t *tsk )
@@ -89,6 +270,12 @@ void tsk_start( tsk_t *tsk )
 			tail->next = tsk;
 			tail = tsk;
 		}
+
+#ifdef  USE_EVENTS
+		tsk->event = NULL;
+		tsk->timer = NULL;
+		sys_wakeup(NULL);
+#endif
 	}
 }
 
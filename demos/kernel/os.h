@@ -103,25 +103,60 @@ typedef intptr_t tag_t;
 // for internal use; pass control to the next ready task if the condition (cnd) is true
 #define TSK_YIELD(cnd)                  TSK_STATE(__LINE__); if (cnd) return; TSK_LABEL(__LINE__): (void)0
 
+#ifdef  USE_EVENTS
+
+// for internal use; wait on the object (obj) while the condition (cnd) is true
+#define TSK_WAIT(obj, cnd)              TSK_STATE(__LINE__); TSK_LABEL(__LINE__): sys.current->event = (obj); if (cnd) return; sys.current->event = NULL
+// for internal use; wait until the timer (tmr) finishes countdown from the end of the previous countdown
+#define TSK_TIMER(tmr)                  TSK_STATE(__LINE__); TSK_LABEL(__LINE__): sys.current->timer = (tmr); if (!tmr_expiredNext(tmr)) return; sys.current->timer = NULL
+// for internal use; make ready all tasks waiting on the object (obj)
+#define TSK_NOTIFY(obj)                 sys_wakeup(obj)
+
+#else//!USE_EVENTS
+
+// for internal use; wait on the object (obj) while the condition (cnd) is true
+#define TSK_WAIT(obj, cnd)              TSK_WHILE(cnd)
+// for internal use; wait until the timer (tmr) finishes countdown from the end of the previous countdown
+#define TSK_TIMER(tmr)                  TSK_WHILE(!tmr_expiredNext(tmr))
+// for internal use; make ready all tasks waiting on the object (obj)
+#define TSK_NOTIFY(obj)                 (void)0
+
+#endif//USE_EVENTS
+
 /* Task ===================================================================== */
 // definition of timer
 typedef struct __tmr { cnt_t start; cnt_t delay; } tmr_t;
 // definition of task state
 typedef enum   __tid { ID_RIP = 0, ID_RDY, ID_DLY } tid_t;
+#ifdef  USE_EVENTS
+// definition of task structure; the task waiting on the object (event) or the timer (timer) is removed from the ready list (ready)
+typedef struct __tsk { tmr_t tmr; tid_t id; tag_t state; fun_t *function; struct __tsk *next; const void *volatile event; tmr_t *timer; struct __tsk *ready; } tsk_t;
+// definition of system
+typedef struct __sys { tsk_t *current; volatile cnt_t counter; bool suspended; volatile bool pending; tmr_t timer; } sys_t;
+#else//!USE_EVENTS
 // definition of task structure
 typedef struct __tsk { tmr_t tmr; tid_t id; tag_t state; fun_t *function; struct __tsk *next; } tsk_t;
 // definition of system
 typedef struct __sys { tsk_t *current; volatile cnt_t counter; bool suspended; } sys_t;
+#endif//USE_EVENTS
 
 // timer initializer
 #define TMR_INIT()                      { 0, 0 }
 // task initializer
+#ifdef  USE_EVENTS
+#define TSK_INIT(fun)                   { TMR_INIT(), ID_RIP, 0, fun, (tsk_t*)NULL, NULL, (tmr_t*)NULL, (tsk_t*)NULL }
+#else//!USE_EVENTS
 #define TSK_INIT(fun)                   { TMR_INIT(), ID_RIP, 0, fun, (tsk_t*)NULL }
+#endif//USE_EVENTS
 
 extern
 sys_t   sys;                         // system struct
 void    tsk_start( tsk_t* );         // system function - make the task ready to execute
 void    sys_start( void );           // system function - start the scheduler
+#ifdef  USE_EVENTS
+void    sys_wakeup( const void* );   // system function - make ready all tasks waiting on the object; can be used in interrupt handlers
+void    sys_idle ( cnt_t );          // user function - called when there is no ready task; parameter: time to the nearest timer expiry or INFINITE
+#endif//USE_EVENTS
 
 #define sys_suspend()              do { sys.suspended = true;                                                      } while(0)
 #define sys_resume()               do { sys.suspended = false;                                                     } while(0)
@@ -167,7 +202,7 @@ void    sys_start( void );           // system function - start the scheduler
 // start new or restart previously stopped task (tsk) with function (fun)
 #define tsk_startFrom(tsk, fun)    do { if ((tsk)->id == ID_RIP) { (tsk)->function = (fun); tsk_start(tsk); }      } while(0)
 // wait while the task (tsk) is working
-#define tsk_join(tsk)              do { tsk_waitUntil((tsk)->id == ID_RIP);                                        } while(0)
+#define tsk_join(tsk)              do { TSK_WAIT(tsk, (tsk)->id != ID_RIP);                                        } while(0)
 // start task (tsk) and wait for the end of execution of (tsk)
 #define tsk_call(tsk)              do { tsk_start(tsk); tsk_join(tsk);                                             } while(0)
 // start new or restart previously stopped task (tsk) with function (fun) and wait for the end of execution of (tsk)
@@ -175,11 +210,11 @@ void    sys_start( void );           // system function - start the scheduler
 // restart the current task from the initial state
 #define tsk_again()                do { sys.current->state = (tag_t)0; return;                                     } while(0)
 // stop the current task; it will no longer be executed
-#define tsk_stop()                 do { sys.current->id = ID_RIP; return;                                          } while(0)
+#define tsk_stop()                 do { sys.current->id = ID_RIP; TSK_NOTIFY(sys.current); return;                 } while(0)
 // stop the current task; it will no longer be executed
-#define tsk_exit()                 do { sys.current->id = ID_RIP; return;                                          } while(0)
+#define tsk_exit()                 do { sys.current->id = ID_RIP; TSK_NOTIFY(sys.current); return;                 } while(0)
 // stop the task (tsk); it will no longer be executed
-#define tsk_kill(tsk)              do { (tsk)->id = ID_RIP; if (tsk_self(tsk)) return;                             } while(0)
+#define tsk_kill(tsk)              do { (tsk)->id = ID_RIP; TSK_NOTIFY(tsk); if (tsk_self(tsk)) return;            } while(0)
 // restart the task (tsk) from the initial state
 #define tsk_restart(tsk)           do { if (tsk_self(tsk)) tsk_again(); tsk_kill(tsk); tsk_start(tsk);             } while(0)
 // restart the task (tsk) with function (fun)
@@ -201,7 +236,7 @@ void    sys_start( void );           // system function - start the scheduler
 // suspend execution of the ready task (tsk)
 #define tsk_suspend(tsk)           do { if ((tsk)->id == ID_RDY) { (tsk)->id = ID_DLY; TSK_YIELD(tsk_self(tsk)); } } while(0)
 // resume execution of the suspended task (tsk)
-#define tsk_resume(tsk)            do { if ((tsk)->id == ID_DLY) { (tsk)->id = ID_RDY; }                           } while(0)
+#define tsk_resume(tsk)            do { if ((tsk)->id == ID_DLY) { (tsk)->id = ID_RDY; TSK_NOTIFY(NULL); }         } while(0)
 
 /* Timer ==================================================================== */
 // define and initialize the timer (tmr)
@@ -218,11 +253,11 @@ void    sys_start( void );           // system function - start the scheduler
 // start/restart the timer (tmr) until given timepoint (tim)
 #define tmr_startUntil(tmr, tim)   do { (tmr)->start = sys_time(); (tmr)->delay = (tim) - (tmr)->start;            } while(0)
 // start/restart the timer (tmr) and wait until the timer (tmr) finishes countdown for given duration of time (dly)
-#define tmr_waitFor(tmr, dly)      do { tmr_startFor(tmr, dly);   tsk_waitUntil(tmr_expiredNext(tmr));             } while(0)
+#define tmr_waitFor(tmr, dly)      do { tmr_startFor(tmr, dly);   TSK_TIMER(tmr);                                  } while(0)
 // wait until the timer (tmr) finishes countdown for given duration of time (dly) from the end of the previous countdown
-#define tmr_waitNext(tmr, dly)     do { tmr_startNext(tmr, dly);  tsk_waitUntil(tmr_expiredNext(tmr));             } while(0)
+#define tmr_waitNext(tmr, dly)     do { tmr_startNext(tmr, dly);  TSK_TIMER(tmr);                                  } while(0)
 // start/restart the timer (tmr) and wait until the timer (tmr) finishes countdown until given timepoint (tim)
-#define tmr_waitUntil(tmr, tim)    do { tmr_startUntil(tmr, tim); tsk_waitUntil(tmr_expiredNext(tmr));             } while(0)
+#define tmr_waitUntil(tmr, tim)    do { tmr_startUntil(tmr, tim); TSK_TIMER(tmr);                                  } while(0)
 
 /* Mutex ==================================================================== */
 // definition of mutex
@@ -237,11 +272,11 @@ typedef tsk_t *mtx_t;
 // alias
 #define mtx_tryLock(mtx)                mtx_take(mtx)
 // wait for the released mutex (mtx) and lock it
-#define mtx_wait(mtx)                   tsk_waitUntil(mtx_take(mtx))
+#define mtx_wait(mtx)              do { TSK_WAIT(mtx, !mtx_take(mtx));                                             } while(0)
 // alias
 #define mtx_lock(mtx)                   mtx_wait(mtx)
 // release previously owned mutex (mtx); return true if the mutex has been successfully released
-#define mtx_give(mtx)                 ( tsk_self(*(mtx)) ? ((*(mtx) = (tsk_t*)NULL), true) : false )
+#define mtx_give(mtx)                 ( tsk_self(*(mtx)) ? ((*(mtx) = (tsk_t*)NULL), TSK_NOTIFY(mtx), true) : false )
 // alias
 #define mtx_unlock(mtx)                 mtx_give(mtx)
 
@@ -262,11 +297,11 @@ typedef uint_fast8_t sem_t;
 // alias
 #define sem_tryWait(sem)                sem_take(sem)
 // wait for the released semaphore (sem) and lock it
-#define sem_wait(sem)                   tsk_waitUntil(sem_take(sem))
+#define sem_wait(sem)              do { TSK_WAIT(sem, !sem_take(sem));                                             } while(0)
 // return true if the semaphore (sem) is locked
 #define sem_taken(sem)                ( *(sem) == 0 )
 // try to release the semaphore (sem); return true if the semaphore has been successfully released
-#define sem_give(sem)                 ( sem_taken(sem) ? ((*(sem) = 1), true) : false )
+#define sem_give(sem)                 ( sem_taken(sem) ? ((*(sem) = 1), TSK_NOTIFY(sem), true) : false )
 // alias
 #define sem_post(sem)                   sem_give(sem)
 // alias
@@ -290,11 +325,11 @@ typedef unsigned sig_t;
 // alias
 #define sig_tryWait(sig, sigset)        sig_take(sig, sigset)
 // wait for the signal (sig) to be set
-#define sig_wait(sig, sigset)           tsk_waitUntil(sig_take(sig, sigset))
+#define sig_wait(sig, sigset)      do { TSK_WAIT(sig, !sig_take(sig, sigset));                                     } while(0)
 // try to reset the signal (sig); return true if the signal has been successfully reset
 #define sig_clear(sig, signo)         ( sig_take(sig, SIGSET(signo)) ? ((*(sig) &= ~SIGSET(signo)), true) : false )
 // try to set the signal (sig); return true if the signal has been successfully set
-#define sig_give(sig, signo)          ( sig_take(sig, SIGSET(signo)) ? false : ((*(sig) |= SIGSET(signo)), true) )
+#define sig_give(sig, signo)          ( sig_take(sig, SIGSET(signo)) ? false : ((*(sig) |= SIGSET(signo)), TSK_NOTIFY(sig), true) )
 // alias
 #define sig_set(sig, signo)             sig_give(sig, signo)
 
@@ -309,9 +344,9 @@ typedef uintptr_t evt_t;
 // get the event (evt) value
 #define evt_take(evt)                 ( *(evt) )
 // wait for a the new value of the event (evt)
-#define evt_wait(evt)              do { *(evt) = 0; tsk_waitUntil(*(evt)); } while(0)
+#define evt_wait(evt)              do { *(evt) = 0; TSK_WAIT(evt, !*(evt)); } while(0)
 // set a new value (val) of the event (evt)
-#define evt_give(evt, val)         do { *(evt) = (val);                    } while(0)
+#define evt_give(evt, val)         do { *(evt) = (val); TSK_NOTIFY(evt);   } while(0)
 
 /* Job ====================================================================== */
 // definition of job
@@ -322,15 +357,15 @@ typedef fun_t *job_t;
 #define OS_JOB(job)                     job_t job[] = { (fun_t*)NULL }
 /* -------------------------------------------------------------------------- */
 // try to take a function from the job (job); return true if the function has been successfully taken and executed
-#define job_take(job)                 ( *(job) ? ((*(job))(), *(job) = (fun_t*)NULL, true) : false )
+#define job_take(job)                 ( *(job) ? ((*(job))(), *(job) = (fun_t*)NULL, TSK_NOTIFY(job), true) : false )
 // alias
 #define job_tryWait(job)                job_take(job)
 // wait for a the new job (job) function, execute it and release the job
-#define job_wait(job)                   tsk_waitUntil(job_take(job))
+#define job_wait(job)              do { TSK_WAIT(job, !job_take(job));                                             } while(0)
 // try to give the new function (fun) to the job (job); return true if the function has been successfully given
-#define job_give(job, fun)            ( *(job) ? false : (*(job) = (fun), true) )
+#define job_give(job, fun)            ( *(job) ? false : (*(job) = (fun), TSK_NOTIFY(job), true) )
 // wait for the released job (job) and give it a new function (fun)
-#define job_send(job, fun)              tsk_waitUntil(job_give(job, fun))
+#define job_send(job, fun)         do { TSK_WAIT(job, !job_give(job, fun));                                        } while(0)
 
 /* Once flag ================================================================ */
 // definition of once flag
@@ -0,0 +1,307 @@
+/******************************************************************************
+
+    @file    DemOS: os.hpp
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   This file provides C++20 coroutine tasks for DemOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2023 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __DEMOS_HPP
+#define __DEMOS_HPP
+
+#if __cplusplus < 202002L
+#error os.hpp: C++20 compiler is required for coroutine tasks
+#endif
+
+#include <coroutine>
+#include <cstddef>
+#include "os.h"
+
+/* Coroutine frame arena ==================================================== */
+
+#ifndef OS_ARENA_SIZE
+#define OS_ARENA_SIZE  1024            // size of the static arena for coroutine frames (in bytes)
+#endif
+
+namespace demos {
+
+namespace arena {
+
+// for internal use; free block of the arena
+struct Block { Block *next; std::size_t size; };
+
+constexpr
+std::size_t Align = alignof(std::max_align_t) > sizeof(Block) ? alignof(std::max_align_t) : sizeof(Block);
+
+// for internal use; round the size (size) up to the arena alignment
+constexpr
+std::size_t round( std::size_t size ) { return (size + Align - 1) & ~(Align - 1); }
+
+alignas(Align)
+inline unsigned char Data[round(OS_ARENA_SIZE)];
+inline std::size_t   Used = 0;         // size of the area taken from the top of the arena
+inline Block        *Free = nullptr;   // list of released blocks, sorted by address
+
+// allocate the block of given size (size) from the arena; return nullptr if there is no space
+inline
+void *alloc( std::size_t size )
+{
+	size = round(size);
+
+	for (Block **ptr = &Free; *ptr != nullptr; ptr = &(*ptr)->next)
+	{
+		Block *blk = *ptr;
+		if (blk->size < size)
+			continue;
+		if (blk->size > size)
+		{
+			Block *rem = reinterpret_cast<Block *>(reinterpret_cast<unsigned char *>(blk) + size);
+			rem->next = blk->next;
+			rem->size = blk->size - size;
+			*ptr = rem;
+		}
+		else
+		{
+			*ptr = blk->next;
+		}
+		return blk;
+	}
+
+	if (size > sizeof(Data) - Used)
+		return nullptr;
+
+	void *ptr = Data + Used;
+	Used += size;
+	return ptr;
+}
+
+// release the block (ptr) of given size (size) to the arena
+inline
+void free( void *ptr, std::size_t size )
+{
+	Block  *blk = static_cast<Block *>(ptr);
+	Block **pos = &Free;
+	Block  *prv = nullptr;
+
+	size = round(size);
+
+	while (*pos != nullptr && *pos < blk)
+	{
+		prv = *pos;
+		pos = &(*pos)->next;
+	}
+
+	blk->next = *pos;
+	blk->size = size;
+	*pos = blk;
+
+	if (blk->next != nullptr && reinterpret_cast<unsigned char *>(blk) + blk->size == reinterpret_cast<unsigned char *>(blk->next))
+	{
+		blk->size += blk->next->size;
+		blk->next  = blk->next->next;
+	}
+
+	if (prv != nullptr && reinterpret_cast<unsigned char *>(prv) + prv->size == reinterpret_cast<unsigned char *>(blk))
+	{
+		prv->size += blk->size;
+		prv->next  = blk->next;
+		blk = prv;
+	}
+
+	if (reinterpret_cast<unsigned char *>(blk) + blk->size == Data + Used)
+	{
+		Used -= blk->size;
+		for (pos = &Free; *pos != blk; pos = &(*pos)->next);
+		*pos = nullptr;
+	}
+}
+
+} // namespace arena
+
+/* Coroutine ================================================================ */
+// definition of coroutine; return type of the task function
+struct Coroutine
+{
+	struct promise_type
+	{
+		static
+		void *operator new( std::size_t size ) noexcept { return arena::alloc(size); }
+		static
+		void  operator delete( void *ptr, std::size_t size ) { arena::free(ptr, size); }
+
+		static
+		Coroutine get_return_object_on_allocation_failure() { return Coroutine(nullptr); }
+
+		Coroutine get_return_object() { return Coroutine(std::coroutine_handle<promise_type>::from_promise(*this)); }
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() {}
+	};
+
+	explicit
+	Coroutine( std::coroutine_handle<promise_type> _handle ): handle_(_handle) {}
+	Coroutine( Coroutine&& _co ): handle_(_co.handle_) { _co.handle_ = nullptr; }
+	~Coroutine() { if (handle_) handle_.destroy(); }
+
+	Coroutine( const Coroutine& ) = delete;
+	Coroutine& operator=( Coroutine&& ) = delete;
+	Coroutine& operator=( const Coroutine& ) = delete;
+
+	std::coroutine_handle<promise_type> handle_;
+};
+
+/* Task ===================================================================== */
+// definition of coroutine task; it is scheduled by sys_start together with the tasks defined by macros
+// the coroutine is executed once; the task is stopped at the end of the coroutine and cannot be restarted
+struct Task : public tsk_t
+{
+	explicit
+	Task( Coroutine&& _co ): tsk_t TSK_INIT(run), co_(static_cast<Coroutine&&>(_co)), poll_(nullptr), wait_(nullptr) {}
+
+	Task( const Task& ) = delete;
+	Task& operator=( const Task& ) = delete;
+
+	// make the task ready to execute
+	void start() { tsk_start(this); }
+	// stop the task; it will no longer be executed
+	void kill () { id = ID_RIP; TSK_NOTIFY(static_cast<tsk_t *>(this)); }
+
+	// return the current task; use only inside the coroutine
+	static
+	Task *current() { return static_cast<Task *>(sys.current); }
+
+	// for internal use; suspend the current task until the function (poll) returns true for the awaiter (wait)
+	void suspend( bool (*_poll)( void * ), void *_wait ) { poll_ = _poll; wait_ = _wait; }
+
+	private:
+
+	static
+	void run()
+	{
+		Task *tsk = current();
+
+		if (tsk->poll_ != nullptr && !tsk->poll_(tsk->wait_))
+			return;
+
+		tsk->poll_ = nullptr;
+
+		if (tsk->co_.handle_ && !tsk->co_.handle_.done())
+			tsk->co_.handle_.resume();
+
+		if (!tsk->co_.handle_ || tsk->co_.handle_.done())
+			tsk->kill();
+	}
+
+	Coroutine co_;
+	bool   (*poll_)( void * );
+	void    *wait_;
+};
+
+/* Awaitables =============================================================== */
+// for internal use; awaiter waiting on the object (obj) or the timer (tmr) until the condition (cnd) is true
+template<typename F>
+struct Await
+{
+	const void *obj;
+	tmr_t      *tmr;
+	F           cnd;
+
+	bool check()
+	{
+	#ifdef  USE_EVENTS
+		sys.current->event = obj;
+		sys.current->timer = tmr;
+	#endif
+		if (!cnd()) return false;
+	#ifdef  USE_EVENTS
+		sys.current->event = nullptr;
+		sys.current->timer = nullptr;
+	#endif
+		return true;
+	}
+
+	static
+	bool poll( void *_wait ) { return static_cast<Await *>(_wait)->check(); }
+
+	bool await_ready  () { return check(); }
+	void await_suspend( std::coroutine_handle<> ) { Task::current()->suspend(poll, this); }
+	void await_resume () {}
+};
+
+template<typename F>
+Await<F> await( const void *_obj, tmr_t *_tmr, F _cnd ) { return Await<F>{ _obj, _tmr, _cnd }; }
+
+// for internal use; awaiter passing control to the next ready task
+struct Yield
+{
+	static
+	bool poll( void * ) { return true; }
+
+	bool await_ready  () { return false; }
+	void await_suspend( std::coroutine_handle<> ) { Task::current()->suspend(poll, nullptr); }
+	void await_resume () {}
+};
+
+/* -------------------------------------------------------------------------- */
+// pass control to the next ready task
+inline Yield yield    ()                               {                                        return {}; }
+// wait while the condition (cnd) is false
+template<typename F>
+inline auto  waitUntil( F cnd )                        { return await(nullptr, nullptr, cnd); }
+// wait while the condition (cnd) is true
+template<typename F>
+inline auto  waitWhile( F cnd )                        { return await(nullptr, nullptr, [cnd]{ return !cnd(); }); }
+// delay execution of current task for given duration of time (dly)
+inline Yield sleepFor ( cnt_t dly )                    { tmr_startFor  (&sys.current->tmr, dly); return {}; }
+// delay execution of current task for given duration of time (dly) from the end of the previous countdown
+inline Yield sleepNext( cnt_t dly )                    { tmr_startNext (&sys.current->tmr, dly); return {}; }
+// delay execution of current task until given timepoint (tim)
+inline Yield sleepUntil( cnt_t tim )                   { tmr_startUntil(&sys.current->tmr, tim); return {}; }
+// start/restart the timer (tmr) and wait until the timer (tmr) finishes countdown for given duration of time (dly)
+inline auto  tmrWaitFor  ( tmr_t *tmr, cnt_t dly )     { tmr_startFor  (tmr, dly); return await(nullptr, tmr, [tmr]{ return tmr_expiredNext(tmr); }); }
+// wait until the timer (tmr) finishes countdown for given duration of time (dly) from the end of the previous countdown
+inline auto  tmrWaitNext ( tmr_t *tmr, cnt_t dly )     { tmr_startNext (tmr, dly); return await(nullptr, tmr, [tmr]{ return tmr_expiredNext(tmr); }); }
+// start/restart the timer (tmr) and wait until the timer (tmr) finishes countdown until given timepoint (tim)
+inline auto  tmrWaitUntil( tmr_t *tmr, cnt_t tim )     { tmr_startUntil(tmr, tim); return await(nullptr, tmr, [tmr]{ return tmr_expiredNext(tmr); }); }
+// wait for the released mutex (mtx) and lock it
+inline auto  mtxWait( mtx_t *mtx )                     { return await(mtx, nullptr, [mtx]{ return mtx_take(mtx); }); }
+// wait for the released semaphore (sem) and lock it
+inline auto  semWait( sem_t *sem )                     { return await(sem, nullptr, [sem]{ return sem_take(sem); }); }
+// wait for the signal (sig) to be set
+inline auto  sigWait( sig_t *sig, sig_t sigset )       { return await(sig, nullptr, [sig, sigset]{ return sig_take(sig, sigset); }); }
+// wait for a the new value of the event (evt)
+inline auto  evtWait( evt_t *evt )                     { *evt = 0; return await(evt, nullptr, [evt]{ return evt_take(evt) != 0; }); }
+// wait for a the new job (job) function, execute it and release the job
+inline auto  jobWait( job_t *job )                     { return await(job, nullptr, [job]{ return job_take(job); }); }
+// wait for the released job (job) and give it a new function (fun)
+inline auto  jobSend( job_t *job, fun_t *fun )         { return await(job, nullptr, [job, fun]{ return job_give(job, fun); }); }
+// wait while the task (tsk) is working
+inline auto  tskJoin( tsk_t *tsk )                     { return await(tsk, nullptr, [tsk]{ return tsk->id == ID_RIP; }); }
+
+} // namespace demos
+
+#endif//__DEMOS_HPP
@@ -0,0 +1,97 @@
+/******************************************************************************
+
+    @file    DemOS: osport.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   DemOS port file for Windows and Linux.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2026 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#if    !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L // clock_gettime and clock_nanosleep are not declared with -std=c11
+#endif
+
+#include "os.h"
+#include <time.h>
+#ifdef  _WIN32
+#include <windows.h>
+#endif
+
+/* --------------------------------------------------------------------------------------------- */
+#ifdef  _WIN32
+
+// return the wall time (in milliseconds); clock of the windows runtime measures the wall time
+cnt_t sys_time( void )
+{
+	return (cnt_t)clock();
+}
+
+#else
+
+// return the monotonic (wall) time; process cpu time (clock) stops when the process is blocked
+cnt_t sys_time( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (cnt_t)ts.tv_sec * (OS_FREQUENCY) + (cnt_t)(ts.tv_nsec / (1000000000L / (OS_FREQUENCY)));
+}
+
+#endif
+/* --------------------------------------------------------------------------------------------- */
+#ifdef  USE_EVENTS
+
+// block the process until the nearest timer expiry; without pending timers wake up once a second
+#ifdef  _WIN32
+
+void sys_idle( cnt_t delay )
+{
+	if (delay == INFINITE || delay > (OS_FREQUENCY))
+		delay = (OS_FREQUENCY);
+
+	Sleep((DWORD)delay);
+}
+
+#else
+
+void sys_idle( cnt_t delay )
+{
+	struct timespec ts;
+	uint64_t ns;
+
+	if (delay == INFINITE || delay > (OS_FREQUENCY))
+		delay = (OS_FREQUENCY);
+
+	ns = (uint64_t)delay * (1000000000L / (OS_FREQUENCY));
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	ts.tv_sec  += (time_t)(ns / 1000000000L) + (ts.tv_nsec + (long)(ns % 1000000000L)) / 1000000000L;
+	ts.tv_nsec  = (ts.tv_nsec + (long)(ns % 1000000000L)) % 1000000000L;
+
+	clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+}
+
+#endif
+#endif//USE_EVENTS
+/* --------------------------------------------------------------------------------------------- */
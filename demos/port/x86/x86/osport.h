@@ -32,21 +32,25 @@
 #ifndef __DEMOSPORT_H
 #define __DEMOSPORT_H
 
-#include <time.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /* --------------------------------------------------------------------------------------------- */
+// the 32-bit counter of microseconds wraps after about 71.6 minutes, of milliseconds after about 49.7 days
+// timers of the kernel measure the elapsed time modulo 2^32, so their delays must not exceed these periods
 
 #ifdef  __linux__
 #define OS_FREQUENCY  1000000
+#else
+#define OS_FREQUENCY     1000
 #endif
 
 /* --------------------------------------------------------------------------------------------- */
 
-typedef clock_t cnt_t;
+typedef uint32_t cnt_t;
 
 /* --------------------------------------------------------------------------------------------- */
 
@@ -54,9 +58,7 @@ static inline
 void sys_init( void ) {}
 
 /* --------------------------------------------------------------------------------------------- */
-
-static inline
-cnt_t sys_time( void ) { return clock(); }
+// sys_time is defined in osport.c, where the POSIX clocks are declared also in the strict ISO C mode
 
 /* --------------------------------------------------------------------------------------------- */
 
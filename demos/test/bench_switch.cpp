@@ -0,0 +1,178 @@
+/******************************************************************************
+
+    @file    DemOS: bench_switch.cpp
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Host benchmark of task switching: tasks defined by macros and coroutine tasks.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2023 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "os.hpp"
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef SWITCHES
+#define SWITCHES 10000000UL // number of task switches in each benchmark
+#endif
+
+volatile cnt_t port_time = 0;
+
+static unsigned long Count;
+static sem_t         Sem = 0;
+static std::chrono::steady_clock::time_point Start;
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef  USE_EVENTS
+void sys_idle( cnt_t ) { std::abort(); } // the benchmark tasks are always ready
+#endif
+
+static void begin()
+{
+	Count = 0;
+	Start = std::chrono::steady_clock::now();
+}
+
+static void end( const char *name )
+{
+	std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - Start;
+	std::printf("%-28s %6.2f ns/switch\n", name, time.count() / SWITCHES);
+}
+
+/* -------------------------------------------------------------------------- */
+// two tasks passing control to each other
+
+OS_TSK_DEF(yield1)
+{
+	tsk_begin();
+
+	if (++Count >= SWITCHES)
+		tsk_stop();
+	tsk_yield();
+
+	tsk_end();
+}
+
+OS_TSK(yield2, yield1__fun);
+
+static demos::Coroutine yielder()
+{
+	while (++Count < SWITCHES)
+		co_await demos::yield();
+}
+
+static demos::Task yield3{ yielder() };
+static demos::Task yield4{ yielder() };
+
+/* -------------------------------------------------------------------------- */
+// two tasks passing a semaphore to each other
+
+OS_TSK_DEF(sem1)
+{
+	tsk_begin();
+
+	sem_wait(&Sem);
+	Count++;
+	sem_give(&Sem);
+	if (Count >= SWITCHES)
+		tsk_stop();
+	tsk_yield();
+
+	tsk_end();
+}
+
+OS_TSK(sem2, sem1__fun);
+
+static demos::Coroutine semaphore()
+{
+	for (;;)
+	{
+		co_await demos::semWait(&Sem);
+		Count++;
+		sem_give(&Sem);
+		if (Count >= SWITCHES)
+			break;
+		co_await demos::yield();
+	}
+}
+
+static demos::Task sem3{ semaphore() };
+static demos::Task sem4{ semaphore() };
+
+/* -------------------------------------------------------------------------- */
+
+static void run( tsk_t *t1, tsk_t *t2 )
+{
+	tsk_start(t1);
+	tsk_start(t2);
+}
+
+OS_TSK_DEF(bench)
+{
+	tsk_begin();
+
+	begin();
+	run(yield1, yield2);
+	tsk_join(yield1);
+	tsk_join(yield2);
+	end("yield (macro tasks)");
+
+	begin();
+	run(&yield3, &yield4);
+	tsk_join(&yield3);
+	tsk_join(&yield4);
+	end("yield (coroutine tasks)");
+
+	begin();
+	sem_give(&Sem);
+	run(sem1, sem2);
+	tsk_join(sem1);
+	tsk_join(sem2);
+	end("semaphore (macro tasks)");
+
+	begin();
+	sem_give(&Sem);
+	run(&sem3, &sem4);
+	tsk_join(&sem3);
+	tsk_join(&sem4);
+	end("semaphore (coroutine tasks)");
+
+	std::exit(EXIT_SUCCESS);
+
+	tsk_end();
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main()
+{
+	tsk_start(bench);
+	sys_start();
+}
+
+/* -------------------------------------------------------------------------- */
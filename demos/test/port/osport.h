@@ -0,0 +1,69 @@
+/******************************************************************************
+
+    @file    DemOS: osport.h
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   DemOS port definitions for host tests (virtual system time).
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2023 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __DEMOSPORT_H
+#define __DEMOSPORT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#define OS_FREQUENCY  1000
+
+/* -------------------------------------------------------------------------- */
+
+typedef uint32_t cnt_t;
+
+/* -------------------------------------------------------------------------- */
+// virtual system time; it is advanced only by the tests (and by their sys_idle)
+
+extern volatile cnt_t port_time;
+
+static inline
+void sys_init( void ) {}
+
+static inline
+cnt_t sys_time( void )
+{
+	return port_time;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//__DEMOSPORT_H
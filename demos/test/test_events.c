@@ -0,0 +1,151 @@
+/******************************************************************************
+
+    @file    DemOS: test_events.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Host test of timers awaited by tasks of the DemOS scheduler.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2023 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "os.h"
+
+/* -------------------------------------------------------------------------- */
+
+#define CHECK( cond ) \
+        do if (!(cond)) { fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); exit(EXIT_FAILURE); } while (0)
+
+#define ROUNDS   5
+#define PERIOD  10
+#define LIMIT   (10*SEC) // the test fails if the tasks have not finished by then
+
+volatile cnt_t port_time = 0;
+
+static tmr_t    Timer = TMR_INIT();
+static unsigned Sleeps, Waits;
+static cnt_t    Idle;            // time spent in the idle procedure
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef USE_EVENTS
+#error  The test requires the event-driven scheduler (USE_EVENTS)!
+#endif
+
+// there is no ready task: jump to the nearest timer expiry
+void sys_idle( cnt_t delay )
+{
+	CHECK(delay != INFINITE); // nothing could ever wake the tasks up
+	port_time += delay;
+	Idle += delay;
+}
+
+/* -------------------------------------------------------------------------- */
+// task sleeping on its own timer
+
+OS_TSK_DEF(sleeper)
+{
+	static cnt_t time;
+
+	tsk_begin();
+
+	time = sys_time();
+	tsk_sleepFor(PERIOD);
+	CHECK(sys_time() - time >= PERIOD);
+	if (++Sleeps == ROUNDS)
+		tsk_stop();
+
+	tsk_end();
+}
+
+/* -------------------------------------------------------------------------- */
+// task waiting for a timer object
+
+OS_TSK_DEF(waiter)
+{
+	static cnt_t time;
+
+	tsk_begin();
+
+	time = sys_time();
+	tmr_waitFor(&Timer, 3 * PERIOD);
+	CHECK(sys_time() - time >= 3 * PERIOD);
+	if (++Waits == ROUNDS)
+		tsk_stop();
+
+	tsk_end();
+}
+
+/* -------------------------------------------------------------------------- */
+// task that is always ready; it keeps the ready list busy while the other tasks are parked
+
+OS_TSK_DEF(busy)
+{
+	tsk_begin();
+
+	port_time++;
+	CHECK(port_time < LIMIT);
+	if (Sleeps == ROUNDS && Waits == ROUNDS)
+		tsk_stop();
+	tsk_yield();
+
+	tsk_end();
+}
+
+/* -------------------------------------------------------------------------- */
+// the busy task has finished, the parked tasks are resumed by the idle procedure only
+
+OS_TSK_DEF(finish)
+{
+	tsk_begin();
+
+	tsk_join(busy);
+
+	Sleeps = Waits = 0;
+	tsk_start(sleeper);
+	tsk_start(waiter);
+	tsk_join(sleeper);
+	tsk_join(waiter);
+
+	CHECK(Sleeps == ROUNDS && Waits == ROUNDS);
+	CHECK(Idle > 0);
+	printf("events: passed\n");
+	exit(EXIT_SUCCESS);
+
+	tsk_end();
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	tsk_start(sleeper);
+	tsk_start(waiter);
+	tsk_start(busy);
+	tsk_start(finish);
+	sys_start();
+}
+
+/* -------------------------------------------------------------------------- */
@@ -11,3 +11,5 @@ add_library(hal INTERFACE)
 target_compile_definitions(hal INTERFACE USE_HAL_DRIVER)
 
 include(${CMAKE_CURRENT_LIST_DIR}/${TARGET_DEVICE}/config.cmake)
+
+include(${CMAKE_CURRENT_LIST_DIR}/stateos/config.cmake)
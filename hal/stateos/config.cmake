@@ -0,0 +1,19 @@
+include_guard(GLOBAL)
+
+project(hal-stateos)
+
+add_library(hal-stateos INTERFACE)
+add_library(hal::stateos ALIAS hal-stateos)
+target_link_libraries(hal-stateos INTERFACE hal stateos::kernel)
+
+target_sources(hal-stateos
+	INTERFACE
+	${CMAKE_CURRENT_LIST_DIR}/src/hal_stateos.c
+)
+
+target_include_directories(hal-stateos
+	INTERFACE
+	${CMAKE_CURRENT_LIST_DIR}/inc
+)
+
+include(${CMAKE_CURRENT_LIST_DIR}/drivers/config.cmake)
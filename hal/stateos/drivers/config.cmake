@@ -0,0 +1,19 @@
+include_guard(GLOBAL)
+
+project(hal-stateos-drivers)
+
+add_library(hal-stateos-drivers INTERFACE)
+add_library(hal::stateos::drivers ALIAS hal-stateos-drivers)
+target_link_libraries(hal-stateos-drivers INTERFACE hal::stateos)
+
+target_sources(hal-stateos-drivers
+	INTERFACE
+	${CMAKE_CURRENT_LIST_DIR}/src/hal_stateos_uart.c
+	${CMAKE_CURRENT_LIST_DIR}/src/hal_stateos_spi.c
+	${CMAKE_CURRENT_LIST_DIR}/src/hal_stateos_i2c.c
+)
+
+target_include_directories(hal-stateos-drivers
+	INTERFACE
+	${CMAKE_CURRENT_LIST_DIR}/inc
+)
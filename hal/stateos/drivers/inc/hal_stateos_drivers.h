@@ -0,0 +1,320 @@
+/******************************************************************************
+
+    @file    StateOS: hal_stateos_drivers.h
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   This file contains definitions of the StateOS uart/spi/i2c adapters for the STM32 HAL.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __HAL_STATEOS_DRIVERS_H
+#define __HAL_STATEOS_DRIVERS_H
+
+#include "hal_stateos.h"
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef HAL_UART_BUFFER
+#define HAL_UART_BUFFER  64 /* size of the reception buffer of the uart adapter (in bytes); it must be accessible by DMA */
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : uart adapter
+ *
+ * Note              : the adapter takes over the HAL_UART_TxCpltCallback, HAL_UART_ErrorCallback
+ *                     and HAL_UARTEx_RxEventCallback procedures
+ *                     if USE_HAL_UART_REGISTER_CALLBACKS is set, the callbacks are registered
+ *                     to the handle instead and the HAL procedures remain free for the application
+ *
+ ******************************************************************************/
+
+#ifdef  HAL_UART_MODULE_ENABLED
+
+typedef struct __hal_uart hal_uart_t;
+
+struct __hal_uart
+{
+	hal_uart_t *         next;   // next registered uart adapter
+	UART_HandleTypeDef * huart;  // handle of the uart peripheral
+	sem_t                sem;    // completion of the transmission
+	volatile
+	HAL_StatusTypeDef    status; // result of the transmission
+	raw_t *              raw;    // stream of the received data (may be NULL)
+	uint16_t             pos;    // position of the received data in the reception buffer
+	uint8_t              buf[HAL_UART_BUFFER]; // reception buffer
+};
+
+/******************************************************************************
+ *
+ * Name              : hal_uart_init
+ *
+ * Description       : register the uart adapter and start the reception
+ *
+ * Parameters
+ *   dev             : pointer to uart adapter
+ *   huart           : handle of the uart peripheral initialized with HAL_UART_Init
+ *   raw             : raw buffer object receiving the data, NULL if reception is not used
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     DMA is used if it is linked to the handle, otherwise the interrupts are used
+ *
+ ******************************************************************************/
+
+void hal_uart_init( hal_uart_t *dev, UART_HandleTypeDef *huart, raw_t *raw );
+
+/******************************************************************************
+ *
+ * Name              : hal_uart_send
+ *
+ * Description       : transmit the data, wait for given duration of time until the transmission is completed
+ *
+ * Parameters
+ *   dev             : pointer to uart adapter
+ *   data            : pointer to the data
+ *   size            : size of the data (in bytes)
+ *   delay           : duration of time (maximum number of ticks to wait for the end of the transmission)
+ *
+ * Return
+ *   HAL_OK          : data was successfully transmitted
+ *   HAL_ERROR       : transmission error
+ *   HAL_BUSY        : uart peripheral is busy
+ *   HAL_TIMEOUT     : transmission was not completed before the specified timeout expired and was aborted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+HAL_StatusTypeDef hal_uart_send( hal_uart_t *dev, const void *data, size_t size, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : hal_uart_recv
+ *
+ * Description       : transfer the received data from the raw buffer object,
+ *                     wait for given duration of time while the raw buffer object is empty
+ *
+ * Parameters
+ *   dev             : pointer to uart adapter
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *   delay           : duration of time (maximum number of ticks to wait while the raw buffer object is empty)
+ *
+ * Return
+ *   HAL_OK          : variable 'read' contains the number of bytes read
+ *   HAL_ERROR       : reception is not used or raw buffer object was reset
+ *   HAL_TIMEOUT     : no data was received before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+HAL_StatusTypeDef hal_uart_recv( hal_uart_t *dev, void *data, size_t size, size_t *read, cnt_t delay );
+
+#endif//HAL_UART_MODULE_ENABLED
+
+/******************************************************************************
+ *
+ * Name              : spi adapter
+ *
+ * Note              : the adapter takes over the HAL_SPI_TxCpltCallback, HAL_SPI_RxCpltCallback,
+ *                     HAL_SPI_TxRxCpltCallback and HAL_SPI_ErrorCallback procedures
+ *                     if USE_HAL_SPI_REGISTER_CALLBACKS is set, the callbacks are registered
+ *                     to the handle instead and the HAL procedures remain free for the application
+ *
+ ******************************************************************************/
+
+#ifdef  HAL_SPI_MODULE_ENABLED
+
+typedef struct __hal_spi hal_spi_t;
+
+struct __hal_spi
+{
+	hal_spi_t *          next;   // next registered spi adapter
+	SPI_HandleTypeDef *  hspi;   // handle of the spi peripheral
+	sem_t                sem;    // completion of the transfer
+	volatile
+	HAL_StatusTypeDef    status; // result of the transfer
+};
+
+/******************************************************************************
+ *
+ * Name              : hal_spi_init
+ *
+ * Description       : register the spi adapter
+ *
+ * Parameters
+ *   dev             : pointer to spi adapter
+ *   hspi            : handle of the spi peripheral initialized with HAL_SPI_Init
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     DMA is used if it is linked to the handle, otherwise the interrupts are used
+ *                     reception of the full-duplex master uses DMA only if both DMA channels are linked
+ *
+ ******************************************************************************/
+
+void hal_spi_init( hal_spi_t *dev, SPI_HandleTypeDef *hspi );
+
+/******************************************************************************
+ *
+ * Name              : hal_spi_transfer
+ *
+ * Description       : transmit and / or receive the data, wait for given duration of time until the transfer is completed
+ *
+ * Parameters
+ *   dev             : pointer to spi adapter
+ *   txd             : pointer to the transmitted data, NULL for reception only
+ *   rxd             : pointer to the buffer of the received data, NULL for transmission only
+ *   size            : size of the transfer (in data frames)
+ *   delay           : duration of time (maximum number of ticks to wait for the end of the transfer)
+ *
+ * Return
+ *   HAL_OK          : data was successfully transferred
+ *   HAL_ERROR       : transfer error
+ *   HAL_BUSY        : spi peripheral is busy
+ *   HAL_TIMEOUT     : transfer was not completed before the specified timeout expired and was aborted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+HAL_StatusTypeDef hal_spi_transfer( hal_spi_t *dev, const void *txd, void *rxd, size_t size, cnt_t delay );
+
+#endif//HAL_SPI_MODULE_ENABLED
+
+/******************************************************************************
+ *
+ * Name              : i2c adapter
+ *
+ * Note              : the adapter takes over the HAL_I2C_MasterTxCpltCallback, HAL_I2C_MasterRxCpltCallback,
+ *                     HAL_I2C_ErrorCallback and HAL_I2C_AbortCpltCallback procedures
+ *                     if USE_HAL_I2C_REGISTER_CALLBACKS is set, the callbacks are registered
+ *                     to the handle instead and the HAL procedures remain free for the application
+ *
+ ******************************************************************************/
+
+#ifdef  HAL_I2C_MODULE_ENABLED
+
+typedef struct __hal_i2c hal_i2c_t;
+
+struct __hal_i2c
+{
+	hal_i2c_t *          next;   // next registered i2c adapter
+	I2C_HandleTypeDef *  hi2c;   // handle of the i2c peripheral
+	sem_t                sem;    // completion of the transfer
+	volatile
+	HAL_StatusTypeDef    status; // result of the transfer
+};
+
+/******************************************************************************
+ *
+ * Name              : hal_i2c_init
+ *
+ * Description       : register the i2c adapter
+ *
+ * Parameters
+ *   dev             : pointer to i2c adapter
+ *   hi2c            : handle of the i2c peripheral initialized with HAL_I2C_Init
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     DMA is used if it is linked to the handle, otherwise the interrupts are used
+ *
+ ******************************************************************************/
+
+void hal_i2c_init( hal_i2c_t *dev, I2C_HandleTypeDef *hi2c );
+
+/******************************************************************************
+ *
+ * Name              : hal_i2c_write
+ *
+ * Description       : transmit the data to the slave device in master mode,
+ *                     wait for given duration of time until the transfer is completed
+ *
+ * Parameters
+ *   dev             : pointer to i2c adapter
+ *   addr            : address of the slave device
+ *   data            : pointer to the data
+ *   size            : size of the data (in bytes)
+ *   delay           : duration of time (maximum number of ticks to wait for the end of the transfer)
+ *
+ * Return
+ *   HAL_OK          : data was successfully transmitted
+ *   HAL_ERROR       : transfer error (e.g. the slave device did not acknowledge)
+ *   HAL_BUSY        : i2c peripheral is busy
+ *   HAL_TIMEOUT     : transfer was not completed before the specified timeout expired and was aborted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+HAL_StatusTypeDef hal_i2c_write( hal_i2c_t *dev, uint16_t addr, const void *data, size_t size, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : hal_i2c_read
+ *
+ * Description       : receive the data from the slave device in master mode,
+ *                     wait for given duration of time until the transfer is completed
+ *
+ * Parameters
+ *   dev             : pointer to i2c adapter
+ *   addr            : address of the slave device
+ *   data            : pointer to the buffer
+ *   size            : size of the data (in bytes)
+ *   delay           : duration of time (maximum number of ticks to wait for the end of the transfer)
+ *
+ * Return
+ *   HAL_OK          : data was successfully received
+ *   HAL_ERROR       : transfer error (e.g. the slave device did not acknowledge)
+ *   HAL_BUSY        : i2c peripheral is busy
+ *   HAL_TIMEOUT     : transfer was not completed before the specified timeout expired and was aborted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+HAL_StatusTypeDef hal_i2c_read( hal_i2c_t *dev, uint16_t addr, void *data, size_t size, cnt_t delay );
+
+#endif//HAL_I2C_MODULE_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__HAL_STATEOS_DRIVERS_H
@@ -0,0 +1,228 @@
+/******************************************************************************
+
+    @file    StateOS: hal_stateos_i2c.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   This file provides the StateOS i2c adapter for the STM32 HAL.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "hal_stateos_drivers.h"
+
+#ifdef  HAL_I2C_MODULE_ENABLED
+
+/* -------------------------------------------------------------------------- */
+
+static hal_i2c_t *I2C_List = NULL; // list of registered i2c adapters
+
+#if     USE_HAL_I2C_REGISTER_CALLBACKS == 1
+static void priv_i2c_cplt ( I2C_HandleTypeDef *hi2c );
+static void priv_i2c_error( I2C_HandleTypeDef *hi2c );
+static void priv_i2c_abort( I2C_HandleTypeDef *hi2c );
+#endif
+
+/* -------------------------------------------------------------------------- */
+static
+hal_i2c_t *priv_i2c_find( I2C_HandleTypeDef *hi2c )
+/* -------------------------------------------------------------------------- */
+{
+	hal_i2c_t *dev = I2C_List;
+
+	while (dev != NULL && dev->hi2c != hi2c)
+		dev = dev->next;
+
+	return dev;
+}
+
+/* -------------------------------------------------------------------------- */
+void hal_i2c_init( hal_i2c_t *dev, I2C_HandleTypeDef *hi2c )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(dev);
+	assert(hi2c);
+
+	sys_lock();
+	{
+		memset(dev, 0, sizeof(hal_i2c_t));
+
+		sem_init(&dev->sem, 0, semBinary);
+		dev->hi2c = hi2c;
+		dev->next = I2C_List;
+		I2C_List  = dev;
+
+#if     USE_HAL_I2C_REGISTER_CALLBACKS == 1
+		// the callbacks of the handle are used instead of the HAL_I2C_xxxCallback procedures
+		HAL_I2C_RegisterCallback(hi2c, HAL_I2C_MASTER_TX_COMPLETE_CB_ID, priv_i2c_cplt);
+		HAL_I2C_RegisterCallback(hi2c, HAL_I2C_MASTER_RX_COMPLETE_CB_ID, priv_i2c_cplt);
+		HAL_I2C_RegisterCallback(hi2c, HAL_I2C_ERROR_CB_ID,              priv_i2c_error);
+		HAL_I2C_RegisterCallback(hi2c, HAL_I2C_ABORT_CB_ID,              priv_i2c_abort);
+#endif
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+HAL_StatusTypeDef priv_i2c_wait( hal_i2c_t *dev, uint16_t addr, HAL_StatusTypeDef status, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	if (status != HAL_OK)
+		dev->status = status;
+	else
+	if (sem_waitFor(&dev->sem, delay) != E_SUCCESS)
+	{
+		// the abort is completed in the interrupt handler (HAL_I2C_AbortCpltCallback)
+		if (HAL_I2C_Master_Abort_IT(dev->hi2c, addr) == HAL_OK)
+			sem_waitFor(&dev->sem, delay);
+		if (dev->status == HAL_BUSY)
+			dev->status = HAL_TIMEOUT;
+	}
+
+	return dev->status;
+}
+
+/* -------------------------------------------------------------------------- */
+HAL_StatusTypeDef hal_i2c_write( hal_i2c_t *dev, uint16_t addr, const void *data, size_t size, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	HAL_StatusTypeDef status;
+
+	assert_tsk_context();
+	assert(dev);
+	assert(data);
+	assert(size <= UINT16_MAX);
+
+	// drop the completion of a transfer that ended after its timeout
+	while (sem_take(&dev->sem) == E_SUCCESS);
+
+	dev->status = HAL_BUSY;
+
+	if (dev->hi2c->hdmatx != NULL)
+		status = HAL_I2C_Master_Transmit_DMA(dev->hi2c, addr, (uint8_t *)data, (uint16_t)size);
+	else
+		status = HAL_I2C_Master_Transmit_IT(dev->hi2c, addr, (uint8_t *)data, (uint16_t)size);
+
+	return priv_i2c_wait(dev, addr, status, delay);
+}
+
+/* -------------------------------------------------------------------------- */
+HAL_StatusTypeDef hal_i2c_read( hal_i2c_t *dev, uint16_t addr, void *data, size_t size, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	HAL_StatusTypeDef status;
+
+	assert_tsk_context();
+	assert(dev);
+	assert(data);
+	assert(size <= UINT16_MAX);
+
+	// drop the completion of a transfer that ended after its timeout
+	while (sem_take(&dev->sem) == E_SUCCESS);
+
+	dev->status = HAL_BUSY;
+
+	if (dev->hi2c->hdmarx != NULL)
+		status = HAL_I2C_Master_Receive_DMA(dev->hi2c, addr, data, (uint16_t)size);
+	else
+		status = HAL_I2C_Master_Receive_IT(dev->hi2c, addr, data, (uint16_t)size);
+
+	return priv_i2c_wait(dev, addr, status, delay);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_i2c_complete( I2C_HandleTypeDef *hi2c, HAL_StatusTypeDef status )
+/* -------------------------------------------------------------------------- */
+{
+	hal_i2c_t *dev = priv_i2c_find(hi2c);
+
+	if (dev != NULL && dev->status == HAL_BUSY)
+	{
+		dev->status = status;
+		sem_giveISR(&dev->sem);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_i2c_cplt( I2C_HandleTypeDef *hi2c )
+/* -------------------------------------------------------------------------- */
+{
+	priv_i2c_complete(hi2c, HAL_OK);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_i2c_error( I2C_HandleTypeDef *hi2c )
+/* -------------------------------------------------------------------------- */
+{
+	priv_i2c_complete(hi2c, HAL_ERROR);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_i2c_abort( I2C_HandleTypeDef *hi2c )
+/* -------------------------------------------------------------------------- */
+{
+	priv_i2c_complete(hi2c, HAL_TIMEOUT);
+}
+
+#if     USE_HAL_I2C_REGISTER_CALLBACKS == 0
+
+/* -------------------------------------------------------------------------- */
+void HAL_I2C_MasterTxCpltCallback( I2C_HandleTypeDef *hi2c )
+/* -------------------------------------------------------------------------- */
+{
+	priv_i2c_cplt(hi2c);
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_I2C_MasterRxCpltCallback( I2C_HandleTypeDef *hi2c )
+/* -------------------------------------------------------------------------- */
+{
+	priv_i2c_cplt(hi2c);
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_I2C_ErrorCallback( I2C_HandleTypeDef *hi2c )
+/* -------------------------------------------------------------------------- */
+{
+	priv_i2c_error(hi2c);
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_I2C_AbortCpltCallback( I2C_HandleTypeDef *hi2c )
+/* -------------------------------------------------------------------------- */
+{
+	priv_i2c_abort(hi2c);
+}
+
+#endif//USE_HAL_I2C_REGISTER_CALLBACKS
+
+/* -------------------------------------------------------------------------- */
+
+#endif//HAL_I2C_MODULE_ENABLED
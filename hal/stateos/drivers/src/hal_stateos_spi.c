@@ -0,0 +1,213 @@
+/******************************************************************************
+
+    @file    StateOS: hal_stateos_spi.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   This file provides the StateOS spi adapter for the STM32 HAL.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "hal_stateos_drivers.h"
+
+#ifdef  HAL_SPI_MODULE_ENABLED
+
+/* -------------------------------------------------------------------------- */
+
+static hal_spi_t *SPI_List = NULL; // list of registered spi adapters
+
+#if     USE_HAL_SPI_REGISTER_CALLBACKS == 1
+static void priv_spi_cplt ( SPI_HandleTypeDef *hspi );
+static void priv_spi_error( SPI_HandleTypeDef *hspi );
+#endif
+
+/* -------------------------------------------------------------------------- */
+static
+hal_spi_t *priv_spi_find( SPI_HandleTypeDef *hspi )
+/* -------------------------------------------------------------------------- */
+{
+	hal_spi_t *dev = SPI_List;
+
+	while (dev != NULL && dev->hspi != hspi)
+		dev = dev->next;
+
+	return dev;
+}
+
+/* -------------------------------------------------------------------------- */
+void hal_spi_init( hal_spi_t *dev, SPI_HandleTypeDef *hspi )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(dev);
+	assert(hspi);
+
+	sys_lock();
+	{
+		memset(dev, 0, sizeof(hal_spi_t));
+
+		sem_init(&dev->sem, 0, semBinary);
+		dev->hspi = hspi;
+		dev->next = SPI_List;
+		SPI_List  = dev;
+
+#if     USE_HAL_SPI_REGISTER_CALLBACKS == 1
+		// the callbacks of the handle are used instead of the HAL_SPI_xxxCallback procedures
+		HAL_SPI_RegisterCallback(hspi, HAL_SPI_TX_COMPLETE_CB_ID,    priv_spi_cplt);
+		HAL_SPI_RegisterCallback(hspi, HAL_SPI_RX_COMPLETE_CB_ID,    priv_spi_cplt);
+		HAL_SPI_RegisterCallback(hspi, HAL_SPI_TX_RX_COMPLETE_CB_ID, priv_spi_cplt);
+		HAL_SPI_RegisterCallback(hspi, HAL_SPI_ERROR_CB_ID,          priv_spi_error);
+#endif
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_spi_rx_dma( SPI_HandleTypeDef *hspi )
+/* -------------------------------------------------------------------------- */
+{
+	// HAL_SPI_Receive_DMA of the full-duplex master forwards to HAL_SPI_TransmitReceive_DMA,
+	// which needs the transmission DMA also
+	if (hspi->Init.Mode == SPI_MODE_MASTER && hspi->Init.Direction == SPI_DIRECTION_2LINES)
+		return hspi->hdmarx != NULL && hspi->hdmatx != NULL;
+
+	return hspi->hdmarx != NULL;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+HAL_StatusTypeDef priv_spi_start( hal_spi_t *dev, const void *txd, void *rxd, uint16_t size )
+/* -------------------------------------------------------------------------- */
+{
+	SPI_HandleTypeDef *hspi = dev->hspi;
+
+	if (rxd == NULL)
+		return hspi->hdmatx != NULL ? HAL_SPI_Transmit_DMA(hspi, (uint8_t *)txd, size)
+		                            : HAL_SPI_Transmit_IT (hspi, (uint8_t *)txd, size);
+	if (txd == NULL)
+		return priv_spi_rx_dma(hspi) ? HAL_SPI_Receive_DMA (hspi, rxd, size)
+		                             : HAL_SPI_Receive_IT  (hspi, rxd, size);
+
+	return hspi->hdmatx != NULL && hspi->hdmarx != NULL ? HAL_SPI_TransmitReceive_DMA(hspi, (uint8_t *)txd, rxd, size)
+	                                                    : HAL_SPI_TransmitReceive_IT (hspi, (uint8_t *)txd, rxd, size);
+}
+
+/* -------------------------------------------------------------------------- */
+HAL_StatusTypeDef hal_spi_transfer( hal_spi_t *dev, const void *txd, void *rxd, size_t size, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	HAL_StatusTypeDef status;
+
+	assert_tsk_context();
+	assert(dev);
+	assert(txd || rxd);
+	assert(size <= UINT16_MAX);
+
+	// drop the completion of a transfer that ended after its timeout
+	while (sem_take(&dev->sem) == E_SUCCESS);
+
+	dev->status = HAL_BUSY;
+
+	status = priv_spi_start(dev, txd, rxd, (uint16_t)size);
+
+	if (status != HAL_OK)
+		dev->status = status;
+	else
+	if (sem_waitFor(&dev->sem, delay) != E_SUCCESS)
+	{
+		HAL_SPI_Abort(dev->hspi);
+		if (dev->status == HAL_BUSY)
+			dev->status = HAL_TIMEOUT;
+	}
+
+	return dev->status;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_spi_complete( SPI_HandleTypeDef *hspi, HAL_StatusTypeDef status )
+/* -------------------------------------------------------------------------- */
+{
+	hal_spi_t *dev = priv_spi_find(hspi);
+
+	if (dev != NULL && dev->status == HAL_BUSY)
+	{
+		dev->status = status;
+		sem_giveISR(&dev->sem);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_spi_cplt( SPI_HandleTypeDef *hspi )
+/* -------------------------------------------------------------------------- */
+{
+	priv_spi_complete(hspi, HAL_OK);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_spi_error( SPI_HandleTypeDef *hspi )
+/* -------------------------------------------------------------------------- */
+{
+	priv_spi_complete(hspi, HAL_ERROR);
+}
+
+#if     USE_HAL_SPI_REGISTER_CALLBACKS == 0
+
+/* -------------------------------------------------------------------------- */
+void HAL_SPI_TxCpltCallback( SPI_HandleTypeDef *hspi )
+/* -------------------------------------------------------------------------- */
+{
+	priv_spi_cplt(hspi);
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_SPI_RxCpltCallback( SPI_HandleTypeDef *hspi )
+/* -------------------------------------------------------------------------- */
+{
+	priv_spi_cplt(hspi);
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_SPI_TxRxCpltCallback( SPI_HandleTypeDef *hspi )
+/* -------------------------------------------------------------------------- */
+{
+	priv_spi_cplt(hspi);
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_SPI_ErrorCallback( SPI_HandleTypeDef *hspi )
+/* -------------------------------------------------------------------------- */
+{
+	priv_spi_error(hspi);
+}
+
+#endif//USE_HAL_SPI_REGISTER_CALLBACKS
+
+/* -------------------------------------------------------------------------- */
+
+#endif//HAL_SPI_MODULE_ENABLED
@@ -0,0 +1,244 @@
+/******************************************************************************
+
+    @file    StateOS: hal_stateos_uart.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   This file provides the StateOS uart adapter for the STM32 HAL.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "hal_stateos_drivers.h"
+
+#ifdef  HAL_UART_MODULE_ENABLED
+
+/* -------------------------------------------------------------------------- */
+
+static hal_uart_t *UART_List = NULL; // list of registered uart adapters
+
+#if     USE_HAL_UART_REGISTER_CALLBACKS == 1
+static void priv_uart_txCplt ( UART_HandleTypeDef *huart );
+static void priv_uart_rxEvent( UART_HandleTypeDef *huart, uint16_t Size );
+static void priv_uart_error  ( UART_HandleTypeDef *huart );
+#endif
+
+/* -------------------------------------------------------------------------- */
+static
+hal_uart_t *priv_uart_find( UART_HandleTypeDef *huart )
+/* -------------------------------------------------------------------------- */
+{
+	hal_uart_t *dev = UART_List;
+
+	while (dev != NULL && dev->huart != huart)
+		dev = dev->next;
+
+	return dev;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_uart_receive( hal_uart_t *dev )
+/* -------------------------------------------------------------------------- */
+{
+	dev->pos = 0;
+
+	if (dev->huart->hdmarx != NULL)
+		HAL_UARTEx_ReceiveToIdle_DMA(dev->huart, dev->buf, sizeof(dev->buf));
+	else
+		HAL_UARTEx_ReceiveToIdle_IT(dev->huart, dev->buf, sizeof(dev->buf));
+}
+
+/* -------------------------------------------------------------------------- */
+void hal_uart_init( hal_uart_t *dev, UART_HandleTypeDef *huart, raw_t *raw )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(dev);
+	assert(huart);
+
+	sys_lock();
+	{
+		memset(dev, 0, sizeof(hal_uart_t));
+
+		sem_init(&dev->sem, 0, semBinary);
+		dev->huart = huart;
+		dev->raw   = raw;
+		dev->next  = UART_List;
+		UART_List  = dev;
+
+#if     USE_HAL_UART_REGISTER_CALLBACKS == 1
+		// the callbacks of the handle are used instead of the HAL_UART_xxxCallback procedures
+		HAL_UART_RegisterCallback(huart, HAL_UART_TX_COMPLETE_CB_ID, priv_uart_txCplt);
+		HAL_UART_RegisterCallback(huart, HAL_UART_ERROR_CB_ID,       priv_uart_error);
+		HAL_UART_RegisterRxEventCallback(huart, priv_uart_rxEvent);
+#endif
+
+		if (raw != NULL)
+			priv_uart_receive(dev);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+HAL_StatusTypeDef hal_uart_send( hal_uart_t *dev, const void *data, size_t size, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	HAL_StatusTypeDef status;
+
+	assert_tsk_context();
+	assert(dev);
+	assert(data);
+	assert(size <= UINT16_MAX);
+
+	// drop the completion of a transmission that ended after its timeout
+	while (sem_take(&dev->sem) == E_SUCCESS);
+
+	dev->status = HAL_BUSY;
+
+	if (dev->huart->hdmatx != NULL)
+		status = HAL_UART_Transmit_DMA(dev->huart, (uint8_t *)data, (uint16_t)size);
+	else
+		status = HAL_UART_Transmit_IT(dev->huart, (uint8_t *)data, (uint16_t)size);
+
+	if (status != HAL_OK)
+		dev->status = status;
+	else
+	if (sem_waitFor(&dev->sem, delay) != E_SUCCESS)
+	{
+		HAL_UART_AbortTransmit(dev->huart);
+		if (dev->status == HAL_BUSY)
+			dev->status = HAL_TIMEOUT;
+	}
+
+	return dev->status;
+}
+
+/* -------------------------------------------------------------------------- */
+HAL_StatusTypeDef hal_uart_recv( hal_uart_t *dev, void *data, size_t size, size_t *read, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(dev);
+	assert(data);
+	assert(size);
+
+	if (dev->raw == NULL)
+		return HAL_ERROR;
+
+	switch (raw_waitFor(dev->raw, data, size, read, delay))
+	{
+	case E_SUCCESS: return HAL_OK;
+	case E_TIMEOUT: return HAL_TIMEOUT;
+	default:        return HAL_ERROR;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_uart_txCplt( UART_HandleTypeDef *huart )
+/* -------------------------------------------------------------------------- */
+{
+	hal_uart_t *dev = priv_uart_find(huart);
+
+	if (dev != NULL && dev->status == HAL_BUSY)
+	{
+		dev->status = HAL_OK;
+		sem_giveISR(&dev->sem);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_uart_rxEvent( UART_HandleTypeDef *huart, uint16_t Size )
+/* -------------------------------------------------------------------------- */
+{
+	hal_uart_t *dev = priv_uart_find(huart);
+
+	if (dev == NULL || dev->raw == NULL)
+		return;
+
+	// 'Size' is the position of the received data in the reception buffer
+	if (Size > dev->pos)
+	{
+		raw_giveISR(dev->raw, &dev->buf[dev->pos], Size - dev->pos);
+		dev->pos = Size;
+	}
+
+	if (dev->pos == sizeof(dev->buf))
+		dev->pos = 0; // circular DMA continues from the beginning of the buffer
+
+	if (huart->RxState == HAL_UART_STATE_READY)
+		priv_uart_receive(dev); // reception was finished (normal DMA or interrupt mode)
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_uart_error( UART_HandleTypeDef *huart )
+/* -------------------------------------------------------------------------- */
+{
+	hal_uart_t *dev = priv_uart_find(huart);
+
+	if (dev == NULL)
+		return;
+
+	// the transmission was aborted by the error
+	if (dev->status == HAL_BUSY && huart->gState == HAL_UART_STATE_READY)
+	{
+		dev->status = HAL_ERROR;
+		sem_giveISR(&dev->sem);
+	}
+
+	if (dev->raw != NULL && huart->RxState == HAL_UART_STATE_READY)
+		priv_uart_receive(dev);
+}
+
+#if     USE_HAL_UART_REGISTER_CALLBACKS == 0
+
+/* -------------------------------------------------------------------------- */
+void HAL_UART_TxCpltCallback( UART_HandleTypeDef *huart )
+/* -------------------------------------------------------------------------- */
+{
+	priv_uart_txCplt(huart);
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_UARTEx_RxEventCallback( UART_HandleTypeDef *huart, uint16_t Size )
+/* -------------------------------------------------------------------------- */
+{
+	priv_uart_rxEvent(huart, Size);
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_UART_ErrorCallback( UART_HandleTypeDef *huart )
+/* -------------------------------------------------------------------------- */
+{
+	priv_uart_error(huart);
+}
+
+#endif//USE_HAL_UART_REGISTER_CALLBACKS
+
+/* -------------------------------------------------------------------------- */
+
+#endif//HAL_UART_MODULE_ENABLED
@@ -0,0 +1,147 @@
+/******************************************************************************
+
+    @file    StateOS: hal_stateos.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   This file provides the StateOS time base for the STM32 HAL.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "hal_stateos.h"
+
+#ifndef MSEC
+#error  hal_stateos.c: OS_FREQUENCY must be at least 1000 Hz!
+#endif
+
+/* -------------------------------------------------------------------------- */
+// The HAL tick (in milliseconds) is derived from the system timer counter.
+// The kernel owns the SysTick (or the tick-less hardware timer),
+// so the HAL does not need its own time base and its own timer interrupt.
+
+static cnt_t    HAL_Last = 0; // value of the system timer counter at the last update of the HAL tick
+static uint32_t HAL_Tick = 0; // HAL tick counter (in milliseconds)
+
+// the HAL tick is refreshed by the timer twice per period of the system timer counter,
+// so the elapsed time is not lost even if HAL_GetTick is not called for longer than the counter period
+
+static void HAL_Refresh( void ) { (void) HAL_GetTick(); }
+static_TMR(HAL_Timer, HAL_Refresh);
+
+// the longest delay (in milliseconds) of a single sleep in HAL_Delay
+#define HAL_DELAY_MAX ((CNT_MAX - 1) / MSEC - 1)
+
+/* -------------------------------------------------------------------------- */
+HAL_StatusTypeDef HAL_InitTick( uint32_t TickPriority )
+/* -------------------------------------------------------------------------- */
+{
+	if (TickPriority >= (1UL << __NVIC_PRIO_BITS))
+		return HAL_ERROR;
+
+	uwTickPrio = TickPriority;
+
+	// make sure the system timer is running
+
+	sys_init();
+	tmr_startPeriodic(HAL_Timer, CNT_MAX / 2);
+
+	return HAL_OK;
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_IncTick( void )
+/* -------------------------------------------------------------------------- */
+{
+	// the HAL tick is driven by the system timer counter
+}
+
+/* -------------------------------------------------------------------------- */
+uint32_t HAL_GetTick( void )
+/* -------------------------------------------------------------------------- */
+{
+	cnt_t    delta;
+	uint32_t tick;
+
+	sys_lock();
+	{
+		// keep the remainder of the millisecond in HAL_Last,
+		// so the HAL tick wraps around at 2^32 regardless of OS_FREQUENCY and OS_TIMER_SIZE;
+		// the time between updates must not exceed the period of the system timer counter (see HAL_Timer)
+		delta = sys_time() - HAL_Last;
+		HAL_Last += delta - delta % MSEC;
+		HAL_Tick += (uint32_t)(delta / MSEC);
+		tick = HAL_Tick;
+	}
+	sys_unlock();
+
+	return tick;
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_Delay( uint32_t Delay )
+/* -------------------------------------------------------------------------- */
+{
+	uint32_t tickstart;
+
+	if (port_isr_context())
+	{
+		// busy wait as the original HAL_Delay; the system timer interrupt must be able to preempt the caller
+		tickstart = HAL_GetTick();
+		if (Delay < HAL_MAX_DELAY)
+			Delay++;
+		while (HAL_GetTick() - tickstart < Delay);
+		return;
+	}
+
+	if (Delay == HAL_MAX_DELAY)
+	{
+		tsk_sleep();
+		return;
+	}
+
+	// the delay in system timer ticks must not overflow the counter
+	while (Delay > HAL_DELAY_MAX)
+	{
+		tsk_sleepFor((cnt_t)HAL_DELAY_MAX * MSEC);
+		Delay -= (uint32_t)HAL_DELAY_MAX;
+	}
+
+	tsk_sleepFor((cnt_t)Delay * MSEC + 1);
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_SuspendTick( void )
+/* -------------------------------------------------------------------------- */
+{
+	// the system timer belongs to the kernel; use sys_suspend / sys_resume instead
+}
+
+/* -------------------------------------------------------------------------- */
+void HAL_ResumeTick( void )
+/* -------------------------------------------------------------------------- */
+{
+	// the system timer belongs to the kernel; use sys_suspend / sys_resume instead
+}
+
+/* -------------------------------------------------------------------------- */
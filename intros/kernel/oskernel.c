@@ -337,10 +337,32 @@ bool priv_tmr_countdown( tmr_t *tmr )
 
 /* -------------------------------------------------------------------------- */
 
+#if HW_IDLE_SLEEP
+
+static
+cnt_t priv_tmr_remaining( tmr_t *tmr, cnt_t delay )
+{
+	cnt_t remaining;
+
+	if (tmr->delay == INFINITE)
+		return delay;
+
+	remaining = tmr->delay - (core_sys_time() - tmr->start);
+
+	return remaining < delay ? remaining : delay;
+}
+
+#endif
+/* -------------------------------------------------------------------------- */
+
 void core_tsk_switch( void )
 {
 	tsk_t *cur;
 	tmr_t *tmr;
+#if HW_IDLE_SLEEP
+	tsk_t *idle = NULL;
+	cnt_t delay = INFINITE;
+#endif
 
 	assert_ctx_integrity(System.cur);
 
@@ -354,9 +376,23 @@ void core_tsk_switch( void )
 
 		if (cur->hdr.id == ID_STOPPED)
 			continue;
+#if HW_IDLE_SLEEP
+		if (cur == idle)
+		{
+			port_sys_idle(delay);
+			delay = INFINITE;
+		}
 		else
+		if (idle == NULL)
+			idle = cur;
+#endif
 		if (cur->delay && priv_tmr_countdown((tmr_t *)cur))
+		{
+#if HW_IDLE_SLEEP
+			delay = priv_tmr_remaining((tmr_t *)cur, delay);
+#endif
 			continue;
+		}
 		else
 		if (cur->hdr.id == ID_READY)
 		{
@@ -215,6 +215,11 @@ cnt_t core_sys_time( void )
 #endif
 }
 
+// block the processor until the nearest deadline (delay) when there is no ready task; INFINITE: no deadline
+#if HW_IDLE_SLEEP
+void port_sys_idle( cnt_t delay );
+#endif
+
 // internal handler of system timer
 __STATIC_INLINE
 void core_sys_tick( void )
@@ -29,7 +29,15 @@
 
  ******************************************************************************/
 
+#if    !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L // clock_gettime and clock_nanosleep are not declared with -std=c11
+#endif
+
 #include "oskernel.h"
+#include <time.h>
+#ifdef  _WIN32
+#include <windows.h>
+#endif
 
 /* -------------------------------------------------------------------------- */
 
@@ -39,6 +47,27 @@ void port_sys_init( void )
 
 /* -------------------------------------------------------------------------- */
 
+#ifdef  _WIN32
+
+uint32_t port_clk_time( void )
+{
+	return (uint32_t)clock(); // clock of the windows runtime measures the wall time
+}
+
+#else
+
+// process cpu time (clock) stops when the process is blocked, so use the monotonic clock
+uint32_t port_clk_time( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)ts.tv_sec * (OS_FREQUENCY) + (uint32_t)(ts.tv_nsec / (1000000000L / (OS_FREQUENCY)));
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 /******************************************************************************
  Tick-less mode: return current system time
 *******************************************************************************/
@@ -53,7 +82,7 @@ cnt_t port_sys_time( void )
 	cnt_t    cnt;
 
 	cnt = System.cnt;
-	tck = clock();
+	tck = port_clk_time();
 
 	if (tck < clk)
 	{
@@ -72,4 +101,45 @@ cnt_t port_sys_time( void )
  End of the function
 *******************************************************************************/
 
+/******************************************************************************
+ Idle: block the process until the nearest deadline (no longer than a second)
+*******************************************************************************/
+
+#if HW_IDLE_SLEEP
+#ifdef  _WIN32
+
+void port_sys_idle( cnt_t delay )
+{
+	if (delay > (OS_FREQUENCY))
+		delay = (OS_FREQUENCY);
+
+	Sleep((DWORD)delay);
+}
+
+#else
+
+void port_sys_idle( cnt_t delay )
+{
+	struct timespec ts;
+	uint64_t ns;
+
+	if (delay > (OS_FREQUENCY))
+		delay = (OS_FREQUENCY);
+
+	ns = (uint64_t)delay * (1000000000L / (OS_FREQUENCY));
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	ts.tv_sec  += (time_t)(ns / 1000000000L) + (ts.tv_nsec + (long)(ns % 1000000000L)) / 1000000000L;
+	ts.tv_nsec  = (ts.tv_nsec + (long)(ns % 1000000000L)) % 1000000000L;
+
+	clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+}
+
+#endif
+#endif
+
+/******************************************************************************
+ End of the function
+*******************************************************************************/
+
 /* -------------------------------------------------------------------------- */
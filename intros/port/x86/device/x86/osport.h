@@ -75,15 +75,31 @@ extern "C" {
 #define HW_TIMER_SIZE        32
 #endif
 
+/* -------------------------------------------------------------------------- */
+// port blocks the process in port_sys_idle when there is no ready task
+
+#ifdef  HW_IDLE_SLEEP
+#error  HW_IDLE_SLEEP is an internal definition!
+#else
+#define HW_IDLE_SLEEP         1
+#endif
+
+/* -------------------------------------------------------------------------- */
+// return current value of the monotonic clock; defined in osport.c, where the POSIX clocks are declared also with -std=c11
+// the 32-bit counter of microseconds wraps after about 71.6 minutes, of milliseconds after about 49.7 days;
+// in the tick-less mode (HW_TIMER_SIZE < OS_TIMER_SIZE) port_sys_time must be called at least once per this period
+
+uint32_t port_clk_time( void );
+
 /* -------------------------------------------------------------------------- */
 // return current system time
 
 #if HW_TIMER_SIZE >= OS_TIMER_SIZE
 
 __STATIC_INLINE
-clock_t port_sys_time( void )
+uint32_t port_sys_time( void )
 {
-	return clock();
+	return port_clk_time();
 }
 
 #endif
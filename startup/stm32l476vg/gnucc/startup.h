@@ -63,6 +63,13 @@ extern char __data_end   [];
 extern char __bss_start  [];
 extern char __bss_end    [];
 
+extern char __fastcode_source[] __WEAK;
+extern char __fastcode_start [] __WEAK;
+extern char __fastcode_end   [] __WEAK;
+extern char __fastdata_source[] __WEAK;
+extern char __fastdata_start [] __WEAK;
+extern char __fastdata_end   [] __WEAK;
+
 /*******************************************************************************
  Default ctors and dtors procedures
 *******************************************************************************/
@@ -82,6 +89,46 @@ void __libc_fini_array(void)
 	for (fini = __fini_array_start; fini < __fini_array_end; fini++) (**fini)();
 }
 */
+/*******************************************************************************
+ Decompression of the data segment (LZ4 block format)
+*******************************************************************************/
+
+#ifdef  __DATA_LZ4
+
+__STATIC_INLINE
+size_t __lz4_length( const unsigned char **src, size_t len )
+{
+	unsigned char byte;
+	if (len == 15)
+		do len += (byte = *(*src)++); while (byte == 255);
+	return len;
+}
+
+__STATIC_INLINE
+void __lz4_decompress( char *dst, char *end, const unsigned char *src )
+{
+	while (dst < end)
+	{
+		unsigned token = *src++;
+		size_t   len   = __lz4_length(&src, token >> 4);
+		const char *ref;
+		/* Copy the literals */
+		memcpy(dst, src, len);
+		dst += len;
+		src += len;
+		/* The last sequence contains only the literals */
+		if (dst >= end)
+			break;
+		ref  = dst - (src[0] | ((size_t)src[1] << 8));
+		src += 2;
+		len  = __lz4_length(&src, token & 15) + 4;
+		/* Copy the match; it can overlap the destination */
+		while (len--) *dst++ = *ref++;
+	}
+}
+
+#endif//__DATA_LZ4
+
 /*******************************************************************************
  Default reset procedures
 *******************************************************************************/
@@ -93,9 +140,17 @@ void __main( void )
 	/* Early hardware init hook */
 	hardware_init_hook();
 	/* Initialize the data segment */
+#ifdef  __DATA_LZ4
+	__lz4_decompress(__data_start, __data_end, (const unsigned char *)__data_source);
+#else
 	memcpy(__data_start, __data_source, (size_t)(__data_end - __data_start));
+#endif
 	/* Zero fill the bss segment */
 	memset(__bss_start, 0, (size_t)(__bss_end - __bss_start));
+	/* Initialize the fast code and data segments */
+	memcpy(__fastcode_start, __fastcode_source, (size_t)(__fastcode_end - __fastcode_start));
+	memcpy(__fastdata_start, __fastdata_source, (size_t)(__fastdata_end - __fastdata_start));
+	__DSB(); __ISB();
 	/* Early software init hook */
 	software_init_hook();
 	/* Call global & static constructors */
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""
+    @file    startup: lz4data.py
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Compress the load image of the .data section with the LZ4 block format.
+
+    usage: lz4data.py [-c OBJCOPY] [-n NM] ELF
+
+    The ELF file is updated in place; the load image of the .data section
+    is replaced by the LZ4 block decompressed by the startup code at boot.
+    The startup code must be compiled with __DATA_LZ4 defined.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+MIN_MATCH = 4       # minimal length of the match
+MF_LIMIT  = 12      # the last match must start at least 12 bytes before the end of the block
+LAST_LIT  = 5       # the last 5 bytes of the block are always literals
+MAX_DIST  = 65535   # maximal offset of the match
+
+def put_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+def put_sequence(out, literals, offset=0, length=0):
+    lit = len(literals)
+    mat = length - MIN_MATCH if offset else 0
+    out.append((min(lit, 15) << 4) | (min(mat, 15) if offset else 0))
+    if lit >= 15:
+        put_length(out, lit - 15)
+    out += literals
+    if offset:
+        out += offset.to_bytes(2, "little")
+        if mat >= 15:
+            put_length(out, mat - 15)
+
+def compress(data):
+    size, out, table = len(data), bytearray(), {}
+    anchor = pos = 0
+    while pos + MF_LIMIT < size:
+        key = data[pos:pos + MIN_MATCH]
+        ref = table.get(key)
+        table[key] = pos
+        if ref is None or pos - ref > MAX_DIST:
+            pos += 1
+            continue
+        length = MIN_MATCH
+        while pos + length < size - LAST_LIT and data[ref + length] == data[pos + length]:
+            length += 1
+        while pos > anchor and ref > 0 and data[pos - 1] == data[ref - 1]:
+            pos, ref, length = pos - 1, ref - 1, length + 1
+        put_sequence(out, data[anchor:pos], pos - ref, length)
+        for i in range(pos + 1, min(pos + length, size - MF_LIMIT)):
+            table[data[i:i + MIN_MATCH]] = i
+        pos = anchor = pos + length
+    put_sequence(out, data[anchor:])
+    return bytes(out)
+
+def decompress(block, size):
+    out, src = bytearray(), 0
+    while len(out) < size:
+        token = block[src]
+        src += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                lit += block[src]
+                src += 1
+                if block[src - 1] != 255:
+                    break
+        out += block[src:src + lit]
+        src += lit
+        if len(out) >= size:
+            break
+        offset = block[src] | (block[src + 1] << 8)
+        src += 2
+        length = token & 15
+        if length == 15:
+            while True:
+                length += block[src]
+                src += 1
+                if block[src - 1] != 255:
+                    break
+        for _ in range(length + MIN_MATCH):
+            out.append(out[-offset])
+    return bytes(out)
+
+def read_symbols(elf, nm):
+    symbols = {}
+    try:
+        out = subprocess.run([nm, elf], check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as err:
+        sys.exit("lz4data.py: cannot read symbols of %s: %s" % (elf, err))
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 3:
+            symbols[fields[2]] = int(fields[0], 16)
+    return symbols
+
+def objcopy(tool, *args):
+    try:
+        subprocess.run([tool, *args], check=True)
+    except (OSError, subprocess.CalledProcessError) as err:
+        sys.exit("lz4data.py: %s failed: %s" % (tool, err))
+
+def main():
+    parser = argparse.ArgumentParser(description="Compress the load image of the .data section with the LZ4 block format.")
+    parser.add_argument("elf", help="ELF file to be updated")
+    parser.add_argument("-c", "--objcopy", default="arm-none-eabi-objcopy", help="objcopy tool (default: arm-none-eabi-objcopy)")
+    parser.add_argument("-n", "--nm", default="arm-none-eabi-nm", help="nm tool (default: arm-none-eabi-nm)")
+    args = parser.parse_args()
+
+    symbols = read_symbols(args.elf, args.nm)
+    if "__data_start" not in symbols or "__data_end" not in symbols:
+        sys.exit("lz4data.py: %s does not define the .data section symbols" % args.elf)
+
+    with tempfile.TemporaryDirectory() as tmp:
+        image = os.path.join(tmp, "data.bin")
+        objcopy(args.objcopy, "-O", "binary", "--only-section=.data", args.elf, image)
+        with open(image, "rb") as f:
+            data = f.read()
+
+        size = symbols["__data_end"] - symbols["__data_start"]
+        if len(data) != size:
+            sys.exit("lz4data.py: the .data section of %s is already compressed" % args.elf)
+        if size == 0:
+            return
+
+        block = compress(data)
+        if decompress(block, size) != data:
+            sys.exit("lz4data.py: internal error, verification of the compressed image failed")
+        # the compressed image must be smaller, otherwise it could overlap the next load image
+        # and it could not be distinguished from the uncompressed one
+        if len(block) >= size:
+            sys.exit("lz4data.py: the .data section of %s is not compressible (%d -> %d bytes), build it without DATA_LZ4" % (args.elf, size, len(block)))
+
+        with open(image, "wb") as f:
+            f.write(block)
+        objcopy(args.objcopy, "--update-section", ".data=" + image, args.elf)
+
+    print("lz4data.py: .data %d -> %d bytes" % (size, len(block)))
+
+if __name__ == "__main__":
+    main()
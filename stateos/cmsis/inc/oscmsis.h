@@ -38,6 +38,46 @@
 #error  osconfig.h: Invalid OS_TASK_EXIT value! It must be a value other than 0.
 #endif
 
+/* -------------------------------------------------------------------------- */
+// Number of slab-allocated control blocks of each type (0: always use the heap)
+// Objects are taken from the heap when the slab is exhausted
+
+#ifndef OS_CMSIS_THREADS
+#define OS_CMSIS_THREADS          0 /* threads (control block with stack) in each stack size class */
+#endif
+
+#ifndef OS_CMSIS_STACK_CLASSES
+#define OS_CMSIS_STACK_CLASSES    1 /* stack size classes: OS_STACK_SIZE, 2*OS_STACK_SIZE, 4*OS_STACK_SIZE, 8*OS_STACK_SIZE */
+#endif
+
+#ifndef OS_CMSIS_TIMERS
+#define OS_CMSIS_TIMERS           0 /* timers */
+#endif
+
+#ifndef OS_CMSIS_EVENT_FLAGS
+#define OS_CMSIS_EVENT_FLAGS      0 /* event flags */
+#endif
+
+#ifndef OS_CMSIS_MUTEXES
+#define OS_CMSIS_MUTEXES          0 /* mutexes */
+#endif
+
+#ifndef OS_CMSIS_SEMAPHORES
+#define OS_CMSIS_SEMAPHORES       0 /* semaphores */
+#endif
+
+#ifndef OS_CMSIS_MEMORY_POOLS
+#define OS_CMSIS_MEMORY_POOLS     0 /* memory pools with user-provided data buffer */
+#endif
+
+#ifndef OS_CMSIS_MESSAGE_QUEUES
+#define OS_CMSIS_MESSAGE_QUEUES   0 /* message queues with user-provided data buffer */
+#endif
+
+#if     OS_CMSIS_STACK_CLASSES < 1 || OS_CMSIS_STACK_CLASSES > 4
+#error  osconfig.h: Invalid OS_CMSIS_STACK_CLASSES value! It must be a value from 1 to 4.
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -56,11 +56,207 @@
 
 /* -------------------------------------------------------------------------- */
 
+#define OS_CMSIS_SLABS (OS_CMSIS_THREADS + OS_CMSIS_TIMERS + OS_CMSIS_EVENT_FLAGS + OS_CMSIS_MUTEXES + \
+                        OS_CMSIS_SEMAPHORES + OS_CMSIS_MEMORY_POOLS + OS_CMSIS_MESSAGE_QUEUES)
+
+#if OS_CMSIS_SLABS
+
+typedef struct __slab
+{
+	void   *next;  // list of released blocks
+	char   *data;  // first block that has never been used
+	char   *base;  // slab buffer
+	char   *end;   // end of slab buffer
+	size_t  size;  // size of block
+}	slab_t;
+
+#define SLAB_INIT(buf) { NULL, (char *)(buf), (char *)(buf), (char *)(buf) + sizeof(buf), sizeof((buf)[0]) }
+
+#define THREAD_STACK_SIZE(cls) osThreadStackSize((size_t)(OS_STACK_SIZE) << (cls))
+#define THREAD_BLOCK_SIZE(cls) ALIGNED_SIZE(osThreadCbSize + THREAD_STACK_SIZE(cls), sizeof(stk_t))
+
+#if OS_CMSIS_THREADS
+static stk_t thread_buf0[OS_CMSIS_THREADS][THREAD_BLOCK_SIZE(0)];
+#if OS_CMSIS_STACK_CLASSES > 1
+static stk_t thread_buf1[OS_CMSIS_THREADS][THREAD_BLOCK_SIZE(1)];
+#endif
+#if OS_CMSIS_STACK_CLASSES > 2
+static stk_t thread_buf2[OS_CMSIS_THREADS][THREAD_BLOCK_SIZE(2)];
+#endif
+#if OS_CMSIS_STACK_CLASSES > 3
+static stk_t thread_buf3[OS_CMSIS_THREADS][THREAD_BLOCK_SIZE(3)];
+#endif
+static slab_t thread_slab[] = {
+	SLAB_INIT(thread_buf0),
+#if OS_CMSIS_STACK_CLASSES > 1
+	SLAB_INIT(thread_buf1),
+#endif
+#if OS_CMSIS_STACK_CLASSES > 2
+	SLAB_INIT(thread_buf2),
+#endif
+#if OS_CMSIS_STACK_CLASSES > 3
+	SLAB_INIT(thread_buf3),
+#endif
+};
+#endif
+
+#if OS_CMSIS_TIMERS
+static osTimer_t        timer_buf[OS_CMSIS_TIMERS];
+static slab_t           timer_slab[] = { SLAB_INIT(timer_buf) };
+#else
+#define                 timer_slab NULL
+#endif
+
+#if OS_CMSIS_EVENT_FLAGS
+static osEventFlags_t   ef_buf[OS_CMSIS_EVENT_FLAGS];
+static slab_t           ef_slab[] = { SLAB_INIT(ef_buf) };
+#else
+#define                 ef_slab NULL
+#endif
+
+#if OS_CMSIS_MUTEXES
+static osMutex_t        mutex_buf[OS_CMSIS_MUTEXES];
+static slab_t           mutex_slab[] = { SLAB_INIT(mutex_buf) };
+#else
+#define                 mutex_slab NULL
+#endif
+
+#if OS_CMSIS_SEMAPHORES
+static osSemaphore_t    semaphore_buf[OS_CMSIS_SEMAPHORES];
+static slab_t           semaphore_slab[] = { SLAB_INIT(semaphore_buf) };
+#else
+#define                 semaphore_slab NULL
+#endif
+
+#if OS_CMSIS_MEMORY_POOLS
+static osMemoryPool_t   mp_buf[OS_CMSIS_MEMORY_POOLS];
+static slab_t           mp_slab[] = { SLAB_INIT(mp_buf) };
+#else
+#define                 mp_slab NULL
+#endif
+
+#if OS_CMSIS_MESSAGE_QUEUES
+static osMessageQueue_t mq_buf[OS_CMSIS_MESSAGE_QUEUES];
+static slab_t           mq_slab[] = { SLAB_INIT(mq_buf) };
+#else
+#define                 mq_slab NULL
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+static bool slab_give (slab_t *slab, void *ptr)
+{
+	if ((char *)ptr < slab->base || (char *)ptr >= slab->end)
+		return false;
+
+	*(void **)ptr = slab->next;
+	slab->next = ptr;
+
+	return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// called by the kernel (with the kernel locked) to release resources of deleted objects
+// installed once by osKernelInitialize; returns false for blocks that do not belong to any slab
+static bool slab_free (void *ptr)
+{
+#if OS_CMSIS_THREADS
+	unsigned cls;
+	for (cls = 0; cls < OS_CMSIS_STACK_CLASSES; cls++)
+		if (slab_give(&thread_slab[cls], ptr)) return true;
+#endif
+#if OS_CMSIS_TIMERS
+	if (slab_give(timer_slab, ptr)) return true;
+#endif
+#if OS_CMSIS_EVENT_FLAGS
+	if (slab_give(ef_slab, ptr)) return true;
+#endif
+#if OS_CMSIS_MUTEXES
+	if (slab_give(mutex_slab, ptr)) return true;
+#endif
+#if OS_CMSIS_SEMAPHORES
+	if (slab_give(semaphore_slab, ptr)) return true;
+#endif
+#if OS_CMSIS_MEMORY_POOLS
+	if (slab_give(mp_slab, ptr)) return true;
+#endif
+#if OS_CMSIS_MESSAGE_QUEUES
+	if (slab_give(mq_slab, ptr)) return true;
+#endif
+	return false;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void *slab_alloc (slab_t *slab)
+{
+	void *ptr;
+
+	if (slab == NULL)
+		return NULL;
+
+	sys_lock();
+	{
+		ptr = slab->next;
+		if (ptr != NULL)
+			slab->next = *(void **)ptr;
+		else
+		if (slab->data < slab->end)
+		{
+			ptr = slab->data;
+			slab->data += slab->size;
+		}
+	}
+	sys_unlock();
+
+	return ptr;
+}
+
+/* -------------------------------------------------------------------------- */
+
+// take a thread control block together with the stack of the smallest size class available
+static osThread_t *thread_alloc (uint32_t *stack_size)
+{
+#if OS_CMSIS_THREADS
+	osThread_t *thread;
+	unsigned    cls;
+
+	for (cls = 0; cls < OS_CMSIS_STACK_CLASSES; cls++)
+	{
+		if (*stack_size > THREAD_STACK_SIZE(cls))
+			continue;
+
+		thread = slab_alloc(&thread_slab[cls]);
+		if (thread != NULL)
+		{
+			*stack_size = THREAD_STACK_SIZE(cls);
+			return thread;
+		}
+	}
+#else
+	(void) stack_size;
+#endif
+	return NULL;
+}
+
+#else
+
+#define slab_alloc(slab) NULL
+#define thread_alloc(stack_size) NULL
+
+#endif//OS_CMSIS_SLABS
+
+/* -------------------------------------------------------------------------- */
+
 osStatus_t osKernelInitialize (void)
 {
 	if (IS_IRQ_MODE() || IS_IRQ_MASKED())
 		return osErrorISR;
 
+#if OS_CMSIS_SLABS
+	core_res_hook(slab_free);
+#endif
 	tsk_prio(osPriorityISR);
 	return osOK;
 }
@@ -213,10 +409,12 @@ osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAtt
 	if (thread == NULL && stack_mem == NULL)
 	{
 		stack_size = osThreadStackSize(stack_size);
-		thread = malloc(osThreadCbSize + stack_size);
-		stack_mem = thread->stk;
+		thread = thread_alloc(&stack_size);
+		if (thread == NULL)
+			thread = malloc(osThreadCbSize + stack_size);
 		if (thread == NULL)
 			return NULL;
+		stack_mem = thread->stk;
 	}
 	else
 	if (thread == NULL)
@@ -585,7 +783,9 @@ osTimerId_t osTimerNew (osTimerFunc_t func, osTimerType_t type, void *argument,
 
 	if (timer == NULL)
 	{
-		timer = malloc(osTimerCbSize);
+		timer = slab_alloc(timer_slab);
+		if (timer == NULL)
+			timer = malloc(osTimerCbSize);
 		if (timer == NULL)
 			return NULL;
 	}
@@ -687,7 +887,9 @@ osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr)
 
 	if (ef == NULL)
 	{
-		ef = malloc(osEventFlagsCbSize);
+		ef = slab_alloc(ef_slab);
+		if (ef == NULL)
+			ef = malloc(osEventFlagsCbSize);
 		if (ef == NULL)
 			return NULL;
 	}
@@ -812,7 +1014,9 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr)
 
 	if (mutex == NULL)
 	{
-		mutex = malloc(osMutexCbSize);
+		mutex = slab_alloc(mutex_slab);
+		if (mutex == NULL)
+			mutex = malloc(osMutexCbSize);
 		if (mutex == NULL)
 			return NULL;
 	}
@@ -918,7 +1122,9 @@ osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, cons
 
 	if (semaphore == NULL)
 	{
-		semaphore = malloc(osSemaphoreCbSize);
+		semaphore = slab_alloc(semaphore_slab);
+		if (semaphore == NULL)
+			semaphore = malloc(osSemaphoreCbSize);
 		if (semaphore == NULL)
 			return NULL;
 	}
@@ -1039,7 +1245,9 @@ osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, con
 	else
 	if (mp == NULL)
 	{
-		mp = malloc(osMemoryPoolCbSize);
+		mp = slab_alloc(mp_slab);
+		if (mp == NULL)
+			mp = malloc(osMemoryPoolCbSize);
 		if (mp == NULL)
 			return NULL;
 	}
@@ -1212,7 +1420,9 @@ osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, con
 	else
 	if (mq == NULL)
 	{
-		mq = malloc(osMessageQueueCbSize);
+		mq = slab_alloc(mq_slab);
+		if (mq == NULL)
+			mq = malloc(osMessageQueueCbSize);
 		if (mq == NULL)
 			return NULL;
 	}
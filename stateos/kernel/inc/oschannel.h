@@ -0,0 +1,584 @@
+/******************************************************************************
+
+    @file    StateOS: oschannel.h
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_CHN_H
+#define __STATEOS_CHN_H
+
+#include "oskernel.h"
+#include "osclock.h"
+#include "osmessagequeue.h"
+
+/******************************************************************************
+ *
+ * Name              : shared channel
+ *
+ * Note              : single-producer single-consumer ring buffer placed in the memory shared between
+ *                     two kernel instances (e.g. on separate cores); 'head' is written only by the receiving
+ *                     kernel, 'tail' only by the sending kernel, so no inter-core lock is needed
+ *                     the shared memory must be zeroed before any kernel uses the channel
+ *                     and must not be cached (or must be kept coherent by the hardware)
+ *
+ ******************************************************************************/
+
+typedef struct __chs chs_t;
+
+struct __chs
+{
+	volatile
+	size_t   head;   // index to read from the data buffer (in bytes)
+	volatile
+	size_t   tail;   // index to write to the data buffer (in bytes)
+#ifndef __cplusplus  // ISO C++ forbids flexible array member
+	char     data[]; // data buffer
+#endif
+};
+
+/******************************************************************************
+ *
+ * Name              : CHN_SIZE
+ *
+ * Description       : size of the shared memory needed for the channel
+ *
+ * Parameters
+ *   limit           : size of a channel (max number of stored messages / bytes)
+ *   size            : max size of a single message (in bytes), 0 for the stream channel
+ *
+ ******************************************************************************/
+
+#define CHN_SIZE( limit, size ) \
+                ( sizeof(chs_t) + ((size) ? ((limit) + 1) * MSG_SIZE(size) : (limit) + 1) )
+
+/******************************************************************************
+ *
+ * Name              : channel
+ *
+ * Note              : local end of the shared channel; each kernel instance has its own channel object
+ *                     referring to the same shared memory; the channel is unidirectional,
+ *                     use two channels for bidirectional communication
+ *
+ ******************************************************************************/
+
+typedef struct __chn chn_t;
+
+struct __chn
+{
+	obj_t    obj;   // object header
+
+	chs_t *  shm;   // shared memory of the channel
+	size_t   limit; // size of the data buffer in the shared memory (in bytes)
+	size_t   size;  // max size of a single message with preceding size of the message (in bytes), 0 for the stream channel
+	fun_t *  bell;  // procedure ringing the doorbell of the other kernel instance (may be NULL)
+};
+
+typedef struct __chn chn_id [];
+
+/******************************************************************************
+ *
+ * Name              : _CHN_INIT
+ *
+ * Description       : create and initialize a channel object
+ *
+ * Parameters
+ *   limit           : size of a channel (max number of stored messages / bytes)
+ *   size            : max size of a single message (in bytes), 0 for the stream channel
+ *   shm             : shared memory of the channel (at least CHN_SIZE(limit, size) bytes)
+ *   bell            : procedure ringing the doorbell of the other kernel instance (may be NULL)
+ *
+ * Return            : channel object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _CHN_INIT( _limit, _size, _shm, _bell ) \
+                    { _OBJ_INIT(), (chs_t *)(_shm), CHN_SIZE(_limit, _size) - sizeof(chs_t), (_size) ? MSG_SIZE(_size) : 0, _bell }
+
+/******************************************************************************
+ *
+ * Name              : OS_CHN_BUFFER
+ *
+ * Description       : define channel shared memory buffer
+ *
+ * Parameters
+ *   buf             : name of the buffer (passed to the init function)
+ *   limit           : size of a channel (max number of stored messages / bytes)
+ *   size            : max size of a single message (in bytes), 0 for the stream channel
+ *
+ * Note              : the buffer must be placed in the memory shared between kernel instances
+ *
+ ******************************************************************************/
+
+#define             OS_CHN_BUFFER( buf, limit, size ) \
+                       size_t buf[ALIGNED_SIZE(CHN_SIZE(limit, size), sizeof(size_t))]
+
+/******************************************************************************
+ *
+ * Name              : OS_CHN
+ * Static alias      : static_CHN
+ *
+ * Description       : define and initialize a channel object
+ *
+ * Parameters
+ *   chn             : name of a pointer to channel object
+ *   limit           : size of a channel (max number of stored messages / bytes)
+ *   size            : max size of a single message (in bytes), 0 for the stream channel
+ *   shm             : shared memory of the channel (at least CHN_SIZE(limit, size) bytes)
+ *   bell            : procedure ringing the doorbell of the other kernel instance (may be NULL)
+ *
+ ******************************************************************************/
+
+#define             OS_CHN( chn, limit, size, shm, bell ) \
+                       chn_t chn[] = { _CHN_INIT( limit, size, shm, bell ) }
+
+#define         static_CHN( chn, limit, size, shm, bell ) \
+                static chn_t chn[] = { _CHN_INIT( limit, size, shm, bell ) }
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : chn_init
+ *
+ * Description       : initialize a channel object
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   size            : max size of a single message (in bytes), 0 for the stream channel
+ *   shm             : shared memory of the channel
+ *   bufsize         : size of the shared memory (in bytes)
+ *   bell            : procedure ringing the doorbell of the other kernel instance (may be NULL)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     both kernel instances must use the same size and shared memory
+ *
+ ******************************************************************************/
+
+void chn_init( chn_t *chn, size_t size, void *shm, size_t bufsize, fun_t *bell );
+
+/******************************************************************************
+ *
+ * Name              : chn_reset
+ * Alias             : chn_kill
+ *
+ * Description       : wake up all waiting tasks of the local kernel with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     data stored in the shared memory is left intact
+ *
+ ******************************************************************************/
+
+void chn_reset( chn_t *chn );
+
+__STATIC_INLINE
+void chn_kill( chn_t *chn ) { chn_reset(chn); }
+
+/******************************************************************************
+ *
+ * Name              : chn_notify
+ * ISR alias         : chn_notifyISR
+ *
+ * Description       : wake up all tasks waiting for the channel object,
+ *                     they will check the state of the shared memory again
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *
+ * Return            : none
+ *
+ * Note              : call from the doorbell interrupt handler raised by the other kernel instance
+ *
+ ******************************************************************************/
+
+void chn_notify( chn_t *chn );
+
+__STATIC_INLINE
+void chn_notifyISR( chn_t *chn ) { chn_notify(chn); }
+
+/******************************************************************************
+ *
+ * Name              : chn_take
+ * Alias             : chn_tryWait
+ * ISR alias         : chn_takeISR
+ *
+ * Description       : try to transfer data from the channel object,
+ *                     don't wait if the channel object is empty
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *
+ * Return
+ *   E_SUCCESS       : variable 'read' contains the number of bytes read from the channel
+ *   E_FAILURE       : not enough space in the buffer (message channel)
+ *   E_TIMEOUT       : channel object is empty, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+int chn_take( chn_t *chn, void *data, size_t size, size_t *read );
+
+__STATIC_INLINE
+int chn_tryWait( chn_t *chn, void *data, size_t size, size_t *read ) { return chn_take(chn, data, size, read); }
+
+__STATIC_INLINE
+int chn_takeISR( chn_t *chn, void *data, size_t size, size_t *read ) { return chn_take(chn, data, size, read); }
+
+/******************************************************************************
+ *
+ * Name              : chn_waitFor
+ *
+ * Description       : try to transfer data from the channel object,
+ *                     wait for given duration of time while the channel object is empty
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *   delay           : duration of time (maximum number of ticks to wait while the channel object is empty)
+ *                     IMMEDIATE: don't wait if the channel object is empty
+ *                     INFINITE:  wait indefinitely while the channel object is empty
+ *
+ * Return
+ *   E_SUCCESS       : variable 'read' contains the number of bytes read from the channel
+ *   E_FAILURE       : not enough space in the buffer (message channel)
+ *   E_STOPPED       : channel object was reset before the specified timeout expired
+ *   E_TIMEOUT       : channel object is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int chn_waitFor( chn_t *chn, void *data, size_t size, size_t *read, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : chn_waitUntil
+ *
+ * Description       : try to transfer data from the channel object,
+ *                     wait until given timepoint while the channel object is empty
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : variable 'read' contains the number of bytes read from the channel
+ *   E_FAILURE       : not enough space in the buffer (message channel)
+ *   E_STOPPED       : channel object was reset before the specified timeout expired
+ *   E_TIMEOUT       : channel object is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int chn_waitUntil( chn_t *chn, void *data, size_t size, size_t *read, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : chn_wait
+ *
+ * Description       : try to transfer data from the channel object,
+ *                     wait indefinitely while the channel object is empty
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *
+ * Return
+ *   E_SUCCESS       : variable 'read' contains the number of bytes read from the channel
+ *   E_FAILURE       : not enough space in the buffer (message channel)
+ *   E_STOPPED       : channel object was reset
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int chn_wait( chn_t *chn, void *data, size_t size, size_t *read ) { return chn_waitFor(chn, data, size, read, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : chn_give
+ * ISR alias         : chn_giveISR
+ *
+ * Description       : try to transfer data to the channel object,
+ *                     don't wait if the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *
+ * Return
+ *   E_SUCCESS       : data was successfully transferred to the channel object
+ *   E_FAILURE       : size of the data is out of the limit
+ *   E_TIMEOUT       : not enough space in the channel, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+int chn_give( chn_t *chn, const void *data, size_t size );
+
+__STATIC_INLINE
+int chn_giveISR( chn_t *chn, const void *data, size_t size ) { return chn_give(chn, data, size); }
+
+/******************************************************************************
+ *
+ * Name              : chn_sendFor
+ *
+ * Description       : try to transfer data to the channel object,
+ *                     wait for given duration of time while the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   delay           : duration of time (maximum number of ticks to wait while the channel object is full)
+ *                     IMMEDIATE: don't wait if the channel object is full
+ *                     INFINITE:  wait indefinitely while the channel object is full
+ *
+ * Return
+ *   E_SUCCESS       : data was successfully transferred to the channel object
+ *   E_FAILURE       : size of the data is out of the limit
+ *   E_STOPPED       : channel object was reset before the specified timeout expired
+ *   E_TIMEOUT       : not enough space in the channel before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int chn_sendFor( chn_t *chn, const void *data, size_t size, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : chn_sendUntil
+ *
+ * Description       : try to transfer data to the channel object,
+ *                     wait until given timepoint while the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : data was successfully transferred to the channel object
+ *   E_FAILURE       : size of the data is out of the limit
+ *   E_STOPPED       : channel object was reset before the specified timeout expired
+ *   E_TIMEOUT       : not enough space in the channel before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int chn_sendUntil( chn_t *chn, const void *data, size_t size, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : chn_send
+ *
+ * Description       : try to transfer data to the channel object,
+ *                     wait indefinitely while the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *
+ * Return
+ *   E_SUCCESS       : data was successfully transferred to the channel object
+ *   E_FAILURE       : size of the data is out of the limit
+ *   E_STOPPED       : channel object was reset
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int chn_send( chn_t *chn, const void *data, size_t size ) { return chn_sendFor(chn, data, size, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : chn_count
+ * ISR alias         : chn_countISR
+ *
+ * Description       : return the amount of data contained in the channel
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *
+ * Return            : amount of data contained in the channel (messages / bytes)
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+size_t chn_count( chn_t *chn );
+
+__STATIC_INLINE
+size_t chn_countISR( chn_t *chn ) { return chn_count(chn); }
+
+/******************************************************************************
+ *
+ * Name              : chn_space
+ * ISR alias         : chn_spaceISR
+ *
+ * Description       : return the amount of free space in the channel
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *
+ * Return            : amount of free space in the channel (messages / bytes)
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+size_t chn_space( chn_t *chn );
+
+__STATIC_INLINE
+size_t chn_spaceISR( chn_t *chn ) { return chn_space(chn); }
+
+/******************************************************************************
+ *
+ * Name              : chn_limit
+ * ISR alias         : chn_limitISR
+ *
+ * Description       : return the size of the channel
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *
+ * Return            : size of the channel (messages / bytes)
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+size_t chn_limit( chn_t *chn );
+
+__STATIC_INLINE
+size_t chn_limitISR( chn_t *chn ) { return chn_limit(chn); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if defined(__cplusplus) && (__cplusplus >= 201103L) && !defined(_GLIBCXX_HAS_GTHREADS)
+namespace stateos {
+
+/******************************************************************************
+ *
+ * Class             : ChannelT<>
+ *
+ * Description       : create and initialize a channel object
+ *
+ * Constructor parameters
+ *   limit           : size of a channel (max number of stored messages / bytes)
+ *   size            : max size of a single message (in bytes), 0 for the stream channel
+ *   shm             : shared memory of the channel (at least CHN_SIZE(limit, size) bytes)
+ *   bell            : procedure ringing the doorbell of the other kernel instance (may be nullptr)
+ *
+ ******************************************************************************/
+
+template<unsigned limit_, size_t size_ = 0>
+struct ChannelT : public __chn
+{
+	constexpr
+	ChannelT( void *_shm, fun_t *_bell = nullptr ): __chn _CHN_INIT(limit_, size_, _shm, _bell) {}
+
+	~ChannelT() { assert(__chn::obj.queue == nullptr); }
+
+	ChannelT( ChannelT&& ) = default;
+	ChannelT( const ChannelT& ) = delete;
+	ChannelT& operator=( ChannelT&& ) = delete;
+	ChannelT& operator=( const ChannelT& ) = delete;
+
+	void     reset    ()                                                                   {        chn_reset    (this); }
+	void     kill     ()                                                                   {        chn_kill     (this); }
+	void     notify   ()                                                                   {        chn_notify   (this); }
+	void     notifyISR()                                                                   {        chn_notifyISR(this); }
+	int      take     (       void *_data, size_t _size, size_t *_read = nullptr )         { return chn_take     (this, _data, _size, _read); }
+	int      tryWait  (       void *_data, size_t _size, size_t *_read = nullptr )         { return chn_tryWait  (this, _data, _size, _read); }
+	int      takeISR  (       void *_data, size_t _size, size_t *_read = nullptr )         { return chn_takeISR  (this, _data, _size, _read); }
+	template<typename T>
+	int      waitFor  (       void *_data, size_t _size, size_t *_read,  const T& _delay ) { return chn_waitFor  (this, _data, _size, _read, Clock::count(_delay)); }
+	template<typename T>
+	int      waitUntil(       void *_data, size_t _size, size_t *_read,  const T& _time )  { return chn_waitUntil(this, _data, _size, _read, Clock::until(_time)); }
+	int      wait     (       void *_data, size_t _size, size_t *_read = nullptr )         { return chn_wait     (this, _data, _size, _read); }
+	int      give     ( const void *_data, size_t _size )                                  { return chn_give     (this, _data, _size); }
+	int      giveISR  ( const void *_data, size_t _size )                                  { return chn_giveISR  (this, _data, _size); }
+	template<typename T>
+	int      sendFor  ( const void *_data, size_t _size, const T& _delay )                 { return chn_sendFor  (this, _data, _size, Clock::count(_delay)); }
+	template<typename T>
+	int      sendUntil( const void *_data, size_t _size, const T& _time )                  { return chn_sendUntil(this, _data, _size, Clock::until(_time)); }
+	int      send     ( const void *_data, size_t _size )                                  { return chn_send     (this, _data, _size); }
+	size_t   count    ()                                                                   { return chn_count    (this); }
+	size_t   countISR ()                                                                   { return chn_countISR (this); }
+	size_t   space    ()                                                                   { return chn_space    (this); }
+	size_t   spaceISR ()                                                                   { return chn_spaceISR (this); }
+	size_t   limit    ()                                                                   { return chn_limit    (this); }
+	size_t   limitISR ()                                                                   { return chn_limitISR (this); }
+};
+
+}     //  namespace
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_CHN_H
@@ -52,6 +52,7 @@ typedef struct __cnd cnd_t;
 struct __cnd
 {
 	obj_t    obj;   // object header
+	mtx_t  * mtx;   // mutex associated with the waiting tasks
 };
 
 typedef struct __cnd cnd_id [];
@@ -70,7 +71,7 @@ typedef struct __cnd cnd_id [];
  *
  ******************************************************************************/
 
-#define               _CND_INIT() { _OBJ_INIT() }
+#define               _CND_INIT() { _OBJ_INIT(), NULL }
 
 /******************************************************************************
  *
@@ -234,6 +235,7 @@ void cnd_delete( cnd_t *cnd ) { cnd_destroy(cnd); }
  *   OWNERDEAD       : owned mutex was locked again but previous owner of the mutex was reseted
  *   E_FAILURE       : mutex object can't be unlocked
  *   E_STOPPED       : condition variable or mutex object was reseted
+ *                     (a mutex reset after the notification is not reported; the mutex is locked again and E_SUCCESS is returned)
  *   E_DELETED       : condition variable or mutex object was deleted
  *   E_TIMEOUT       : condition variable object was not signalled before the specified timeout expired; owned mutex was locked again
  *
@@ -260,6 +262,7 @@ int cnd_waitFor( cnd_t *cnd, mtx_t *mtx, cnt_t delay );
  *   OWNERDEAD       : owned mutex was locked again but previous owner of the mutex was reseted
  *   E_FAILURE       : mutex object can't be unlocked
  *   E_STOPPED       : condition variable or mutex object was reseted
+ *                     (a mutex reset after the notification is not reported; the mutex is locked again and E_SUCCESS is returned)
  *   E_DELETED       : condition variable or mutex object was deleted
  *   E_TIMEOUT       : condition variable object was not signalled before the specified timeout expired; owned mutex was locked again
  *
@@ -285,6 +288,7 @@ int cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time );
  *   OWNERDEAD       : owned mutex was locked again but previous owner of the mutex was reseted
  *   E_FAILURE       : mutex object can't be unlocked
  *   E_STOPPED       : condition variable or mutex object was reseted
+ *                     (a mutex reset after the notification is not reported; the mutex is locked again and E_SUCCESS is returned)
  *   E_DELETED       : condition variable or mutex object was deleted
  *
  * Note              : use only in thread mode
@@ -53,6 +53,12 @@ struct __evq
 	unsigned head;  // first element to read from data buffer
 	unsigned tail;  // first element to write into data buffer
 	unsigned*data;  // data buffer
+#if OS_ATOMICS
+	unsigned space; // number of elements available for async producers
+	unsigned prod;  // state of async producers
+	unsigned cons;  // state of async consumers
+	ntf_t    ntf;   // request to resume waiting tasks posted by async operations in interrupt handlers
+#endif
 };
 
 typedef struct __evq evq_id [];
@@ -73,7 +79,11 @@ typedef struct __evq evq_id [];
  *
  ******************************************************************************/
 
+#if OS_ATOMICS
+#define               _EVQ_INIT( _limit, _data ) { _OBJ_INIT(), 0, _limit, 0, 0, _data, _limit, 0, 0, _NTF_INIT() }
+#else
 #define               _EVQ_INIT( _limit, _data ) { _OBJ_INIT(), 0, _limit, 0, 0, _data }
+#endif
 
 /******************************************************************************
  *
@@ -281,6 +291,7 @@ void evq_delete( evq_t *evq ) { evq_destroy(evq); }
  * Note              : can be used in both thread and handler mode
  *                     use ISR alias in blockable interrupt handlers
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     if Async alias is used, all producers and consumers of the object must use it
  *
  ******************************************************************************/
 
@@ -360,11 +371,12 @@ int evq_waitUntil( evq_t *evq, unsigned *event, cnt_t time );
  *
  * Return
  *   E_SUCCESS       : event value was successfully transferred from the event queue object
- *   E_STOPPED       : event queue object was reseted (unavailable for async version)
- *   E_DELETED       : event queue object was deleted (unavailable for async version)
+ *   E_STOPPED       : event queue object was reseted
+ *   E_DELETED       : event queue object was deleted
  *
  * Note              : use only in thread mode
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     if Async alias is used, all producers and consumers of the object must use it
  *
  ******************************************************************************/
 
@@ -395,6 +407,7 @@ int evq_waitAsync( evq_t *evq, unsigned *event );
  * Note              : can be used in both thread and handler mode
  *                     use ISR alias in blockable interrupt handlers
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     if Async alias is used, all producers and consumers of the object must use it
  *
  ******************************************************************************/
 
@@ -471,11 +484,12 @@ int evq_sendUntil( evq_t *evq, unsigned event, cnt_t time );
  *
  * Return
  *   E_SUCCESS       : event value was successfully transferred to the event queue object
- *   E_STOPPED       : event queue object was reseted (unavailable for async version)
- *   E_DELETED       : event queue object was deleted (unavailable for async version)
+ *   E_STOPPED       : event queue object was reseted
+ *   E_DELETED       : event queue object was deleted
  *
  * Note              : use only in thread mode
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     if Async alias is used, all producers and consumers of the object must use it
  *
  ******************************************************************************/
 
@@ -600,7 +614,7 @@ template<unsigned limit_>
 struct EventQueueT : public __evq
 {
 	constexpr
-	EventQueueT(): __evq _EVQ_INIT(limit_, data_) {}
+	EventQueueT(): __evq _EVQ_INIT(limit_, data_) _CONSTINIT(data_) {}
 
 	~EventQueueT() { assert(__evq::obj.queue == nullptr); }
 
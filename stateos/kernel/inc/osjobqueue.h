@@ -596,7 +596,7 @@ template<unsigned limit_>
 struct JobQueueT : public __job
 {
 	constexpr
-	JobQueueT(): __job _JOB_INIT(limit_, data_) {}
+	JobQueueT(): __job _JOB_INIT(limit_, data_) _CONSTINIT(data_) {}
 
 	~JobQueueT() { assert(__job::obj.queue == nullptr); }
 
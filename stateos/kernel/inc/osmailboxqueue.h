@@ -54,6 +54,12 @@ struct __box
 	size_t   head;  // first element to read from data buffer
 	size_t   tail;  // first element to write into data buffer
 	char *   data;  // data buffer
+#if OS_ATOMICS
+	size_t   space; // size of memory available for async producers (in bytes)
+	unsigned prod;  // state of async producers
+	unsigned cons;  // state of async consumers
+	ntf_t    ntf;   // request to resume waiting tasks posted by async operations in interrupt handlers
+#endif
 };
 
 typedef struct __box box_id [];
@@ -75,7 +81,11 @@ typedef struct __box box_id [];
  *
  ******************************************************************************/
 
+#if OS_ATOMICS
+#define               _BOX_INIT( _limit, _size, _data ) { _OBJ_INIT(), 0, _limit * _size, _size, 0, 0, _data, _limit * _size, 0, 0, _NTF_INIT() }
+#else
 #define               _BOX_INIT( _limit, _size, _data ) { _OBJ_INIT(), 0, _limit * _size, _size, 0, 0, _data }
+#endif
 
 /******************************************************************************
  *
@@ -290,6 +300,7 @@ void box_delete( box_t *box ) { box_destroy(box); }
  * Note              : can be used in both thread and handler mode
  *                     use ISR alias in blockable interrupt handlers
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     if Async alias is used, all producers and consumers of the object must use it
  *
  ******************************************************************************/
 
@@ -369,11 +380,12 @@ int box_waitUntil( box_t *box, void *data, cnt_t time );
  *
  * Return
  *   E_SUCCESS       : mailbox data was successfully transferred from the mailbox queue object
- *   E_STOPPED       : mailbox queue object was reseted (unavailable for async version)
- *   E_DELETED       : mailbox queue object was deleted (unavailable for async version)
+ *   E_STOPPED       : mailbox queue object was reseted
+ *   E_DELETED       : mailbox queue object was deleted
  *
  * Note              : use only in thread mode
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     if Async alias is used, all producers and consumers of the object must use it
  *
  ******************************************************************************/
 
@@ -404,6 +416,7 @@ int box_waitAsync( box_t *box, void *data );
  * Note              : can be used in both thread and handler mode
  *                     use ISR alias in blockable interrupt handlers
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     if Async alias is used, all producers and consumers of the object must use it
  *
  ******************************************************************************/
 
@@ -480,11 +493,12 @@ int box_sendUntil( box_t *box, const void *data, cnt_t time );
  *
  * Return
  *   E_SUCCESS       : mailbox data was successfully transferred to the mailbox queue object
- *   E_STOPPED       : mailbox queue object was reseted (unavailable for async version)
- *   E_DELETED       : mailbox queue object was deleted (unavailable for async version)
+ *   E_STOPPED       : mailbox queue object was reseted
+ *   E_DELETED       : mailbox queue object was deleted
  *
  * Note              : use only in thread mode
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     if Async alias is used, all producers and consumers of the object must use it
  *
  ******************************************************************************/
 
@@ -633,7 +647,7 @@ template<unsigned limit_, size_t size_>
 struct MailBoxQueueT : public __box
 {
 	constexpr
-	MailBoxQueueT(): __box _BOX_INIT(limit_, size_, data_) {}
+	MailBoxQueueT(): __box _BOX_INIT(limit_, size_, data_) _CONSTINIT(data_) {}
 
 	~MailBoxQueueT() { assert(__box::obj.queue == nullptr); }
 
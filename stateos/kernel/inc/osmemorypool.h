@@ -421,7 +421,8 @@ namespace stateos {
 template<unsigned limit_, size_t size_>
 struct MemoryPoolT : public __mem
 {
-	MemoryPoolT(): __mem _MEM_INIT(limit_, MEM_SIZE(size_), data_) {}
+	constexpr
+	MemoryPoolT(): __mem _MEM_INIT(limit_, MEM_SIZE(size_), data_) _CONSTINIT(data_) {}
 
 	~MemoryPoolT() { assert(__mem::lst.obj.queue == nullptr); }
 
@@ -494,6 +495,7 @@ struct MemoryPoolT : public __mem
 template<unsigned limit_, class C>
 struct MemoryPoolTT : public MemoryPoolT<limit_, sizeof(C)>
 {
+	constexpr
 	MemoryPoolTT(): MemoryPoolT<limit_, sizeof(C)>() {}
 
 	int  take     ( C **_data )                  { return mem_take     (this, reinterpret_cast<void **>(_data)); }
@@ -219,6 +219,8 @@ extern "C" {
  * Return            : none
  *
  * Note              : use only in thread mode
+ *                     if OS_MSG_PACKED is set, messages of any size up to 'size' are packed back-to-back
+ *                     in the data buffer, so the queue capacity is bounded by 'bufsize' rather than by slots
  *
  ******************************************************************************/
 
@@ -576,6 +578,7 @@ int msg_pushISR( msg_t *msg, const void *data, size_t size ) { return msg_push(m
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     if OS_MSG_PACKED is set, returns the number of bytes used by stored messages and their headers
  *
  ******************************************************************************/
 
@@ -598,6 +601,8 @@ size_t msg_countISR( msg_t *msg ) { return msg_count(msg); }
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     if OS_MSG_PACKED is set, returns the number of free bytes
+ *                     (a message needs MSG_SIZE(size) bytes and may have to skip the end of the buffer)
  *
  ******************************************************************************/
 
@@ -620,6 +625,7 @@ size_t msg_spaceISR( msg_t *msg ) { return msg_space(msg); }
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     if OS_MSG_PACKED is set, returns the size of the data buffer (in bytes)
  *
  ******************************************************************************/
 
@@ -676,7 +682,7 @@ template<unsigned limit_, size_t size_>
 struct MessageQueueT : public __msg
 {
 	constexpr
-	MessageQueueT(): __msg _MSG_INIT(limit_, size_, data_) {}
+	MessageQueueT(): __msg _MSG_INIT(limit_, size_, data_) _CONSTINIT(data_) {}
 
 	~MessageQueueT() { assert(__msg::obj.queue == nullptr); }
 
@@ -57,7 +57,10 @@
 /////// inconsistency of robust mutex
 #define mtxInconsistent 32U // inconsistent mutex
 
-#define mtxMASK        ( mtxTypeMASK | mtxPrioMASK | mtxRobust | mtxInconsistent )
+/////// mutex on the list of mutexes held by its owner (for internal use)
+#define mtxLinked       64U // linked mutex
+
+#define mtxMASK        ( mtxTypeMASK | mtxPrioMASK | mtxRobust | mtxInconsistent | mtxLinked )
 
 /* -------------------------------------------------------------------------- */
 
@@ -611,7 +611,7 @@ template<size_t limit_>
 struct RawBufferT : public __raw
 {
 	constexpr
-	RawBufferT(): __raw _RAW_INIT(limit_, data_) {}
+	RawBufferT(): __raw _RAW_INIT(limit_, data_) _CONSTINIT(data_) {}
 
 	~RawBufferT() { assert(__raw::obj.queue == nullptr); }
 
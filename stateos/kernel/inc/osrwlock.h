@@ -37,6 +37,15 @@
 
 /* -------------------------------------------------------------------------- */
 
+/////// read/write lock policy
+#define rwlPreferRead    0U // readers are admitted while no writer holds the lock, the writer passes the lock to the next writer
+#define rwlPreferWrite   1U // readers are not admitted while any writer is waiting
+#define rwlPhaseFair     2U // read and write phases alternate
+#define rwlDefault       rwlPreferRead
+#define rwlMASK        ( rwlPreferRead | rwlPreferWrite | rwlPhaseFair )
+
+/* -------------------------------------------------------------------------- */
+
 #define RDR_LIMIT    ( 0U-1 )
 
 /******************************************************************************
@@ -52,8 +61,10 @@ struct __rwl
 	obj_t    obj;   // object header
 
 	tsk_t  * queue; // readers queue
+	tsk_t  * upgrd; // reader waiting for upgrade to the writer
 	bool     write; // writer is active
 	unsigned count; // number of active readers
+	unsigned mode;  // read/write lock policy
 };
 
 typedef struct __rwl rwl_id [];
@@ -64,7 +75,8 @@ typedef struct __rwl rwl_id [];
  *
  * Description       : create and initialize a read/write lock object
  *
- * Parameters        : none
+ * Parameters
+ *   mode            : read/write lock policy: rwlPreferRead or rwlPreferWrite or rwlPhaseFair
  *
  * Return            : read/write lock object
  *
@@ -72,7 +84,20 @@ typedef struct __rwl rwl_id [];
  *
  ******************************************************************************/
 
-#define               _RWL_INIT() { _OBJ_INIT(), NULL, false, 0 }
+#define               _RWL_INIT( _mode ) { _OBJ_INIT(), NULL, NULL, false, 0, _mode }
+
+/******************************************************************************
+ *
+ * Name              : _VA_RWL
+ *
+ * Description       : calculate read/write lock policy from optional parameter
+ *                     default: rwlDefault
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _VA_RWL( _mode ) ( _mode + 0 )
 
 /******************************************************************************
  *
@@ -83,14 +108,15 @@ typedef struct __rwl rwl_id [];
  *
  * Parameters
  *   rwl             : name of a pointer to read/write lock object
+ *   mode            : (optional) read/write lock policy: rwlPreferRead or rwlPreferWrite or rwlPhaseFair
  *
  ******************************************************************************/
 
-#define             OS_RWL( rwl ) \
-                       rwl_t rwl[] = { _RWL_INIT() }
+#define             OS_RWL( rwl, ... ) \
+                       rwl_t rwl[] = { _RWL_INIT( _VA_RWL(__VA_ARGS__) ) }
 
-#define         static_RWL( rwl ) \
-                static rwl_t rwl[] = { _RWL_INIT() }
+#define         static_RWL( rwl, ... ) \
+                static rwl_t rwl[] = { _RWL_INIT( _VA_RWL(__VA_ARGS__) ) }
 
 /******************************************************************************
  *
@@ -98,7 +124,8 @@ typedef struct __rwl rwl_id [];
  *
  * Description       : create and initialize a read/write lock object
  *
- * Parameters        : none
+ * Parameters
+ *   mode            : (optional) read/write lock policy: rwlPreferRead or rwlPreferWrite or rwlPhaseFair
  *
  * Return            : read/write lock object
  *
@@ -107,8 +134,8 @@ typedef struct __rwl rwl_id [];
  ******************************************************************************/
 
 #ifndef __cplusplus
-#define                RWL_INIT() \
-                      _RWL_INIT()
+#define                RWL_INIT( ... ) \
+                      _RWL_INIT( _VA_RWL(__VA_ARGS__) )
 #endif
 
 /******************************************************************************
@@ -118,7 +145,8 @@ typedef struct __rwl rwl_id [];
  *
  * Description       : create and initialize a read/write lock object
  *
- * Parameters        : none
+ * Parameters
+ *   mode            : (optional) read/write lock policy: rwlPreferRead or rwlPreferWrite or rwlPhaseFair
  *
  * Return            : read/write lock object as array (id)
  *
@@ -127,8 +155,8 @@ typedef struct __rwl rwl_id [];
  ******************************************************************************/
 
 #ifndef __cplusplus
-#define                RWL_CREATE() \
-                     { RWL_INIT  () }
+#define                RWL_CREATE( ... ) \
+                     { RWL_INIT  ( _VA_RWL(__VA_ARGS__) ) }
 #define                RWL_NEW \
                        RWL_CREATE
 #endif
@@ -175,6 +203,30 @@ rwl_t *rwl_create( void );
 __STATIC_INLINE
 rwl_t *rwl_new( void ) { return rwl_create(); }
 
+/******************************************************************************
+ *
+ * Name              : rwl_setMode
+ *
+ * Description       : set the policy of the read/write lock object
+ *
+ * Parameters
+ *   rwl             : pointer to read/write lock object
+ *   mode            : read/write lock policy
+ *                     rwlPreferRead:  readers are admitted while no writer holds the lock,
+ *                                     the releasing writer passes the lock to the next waiting writer (default)
+ *                     rwlPreferWrite: readers are not admitted while any writer is waiting,
+ *                                     the releasing writer passes the lock to the next waiting writer
+ *                     rwlPhaseFair:   readers are not admitted while any writer is waiting,
+ *                                     the releasing writer admits all waiting readers
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rwl_setMode( rwl_t *rwl, unsigned mode );
+
 /******************************************************************************
  *
  * Name              : rwl_reset
@@ -447,6 +499,8 @@ int rwl_lockWrite( rwl_t *rwl ) { return rwl_waitWrite(rwl); }
  * Return            : none
  *
  * Note              : use only in thread mode
+ *                     the lock is passed to the next waiting writer, if any, otherwise all waiting readers are admitted;
+ *                     with rwlPhaseFair policy waiting readers are admitted first
  *
  ******************************************************************************/
 
@@ -455,6 +509,76 @@ void rwl_giveWrite( rwl_t *rwl );
 __STATIC_INLINE
 void rwl_unlockWrite( rwl_t *rwl ) { rwl_giveWrite(rwl); }
 
+/******************************************************************************
+ *
+ * Name              : rwl_upgradeFor
+ *
+ * Description       : atomically convert the reader lock held by the current task into the writer lock,
+ *                     wait for given duration of time until all other readers unlock
+ *
+ * Parameters
+ *   rwl             : pointer to read/write lock object
+ *   delay           : duration of time (maximum number of ticks to wait for upgrade the reader)
+ *                     IMMEDIATE: don't wait if the reader can't be upgraded immediately
+ *                     INFINITE:  wait indefinitely until the reader has been upgraded
+ *
+ * Return
+ *   E_SUCCESS       : reader was successfully upgraded to the writer
+ *   E_FAILURE       : another reader is already waiting for upgrade
+ *   E_STOPPED       : read/write lock was reseted before the specified timeout expired
+ *   E_DELETED       : read/write lock was deleted before the specified timeout expired
+ *   E_TIMEOUT       : reader was not upgraded before the specified timeout expired, reader lock is still held
+ *
+ * Note              : use only in thread mode
+ *                     current task must hold the reader lock
+ *
+ ******************************************************************************/
+
+int rwl_upgradeFor( rwl_t *rwl, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : rwl_upgrade
+ *
+ * Description       : atomically convert the reader lock held by the current task into the writer lock,
+ *                     wait indefinitely until all other readers unlock
+ *
+ * Parameters
+ *   rwl             : pointer to read/write lock object
+ *
+ * Return
+ *   E_SUCCESS       : reader was successfully upgraded to the writer
+ *   E_FAILURE       : another reader is already waiting for upgrade
+ *   E_STOPPED       : read/write lock was reseted
+ *   E_DELETED       : read/write lock was deleted
+ *
+ * Note              : use only in thread mode
+ *                     current task must hold the reader lock
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int rwl_upgrade( rwl_t *rwl ) { return rwl_upgradeFor(rwl, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : rwl_downgrade
+ *
+ * Description       : atomically convert the writer lock held by the current task into the reader lock,
+ *                     admit waiting readers according to the read/write lock policy
+ *
+ * Parameters
+ *   rwl             : pointer to read/write lock object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     current task must hold the writer lock
+ *
+ ******************************************************************************/
+
+void rwl_downgrade( rwl_t *rwl );
+
 #ifdef __cplusplus
 }
 #endif
@@ -471,14 +595,15 @@ namespace stateos {
  * Description       : create and initialize a read/write lock object
  *
  * Constructor parameters
- *                   : none
+ *   mode            : read/write lock policy: rwlPreferRead or rwlPreferWrite or rwlPhaseFair
+ *                     none: rwlDefault
  *
  ******************************************************************************/
 
 struct RWLock : public __rwl
 {
 	constexpr
-	RWLock(): __rwl _RWL_INIT() {}
+	RWLock( const unsigned _mode = rwlDefault ): __rwl _RWL_INIT(_mode) {}
 
 	~RWLock() { assert(__rwl::write == false && __rwl::count == 0); }
 
@@ -487,6 +612,7 @@ struct RWLock : public __rwl
 	RWLock& operator=( RWLock&& ) = delete;
 	RWLock& operator=( const RWLock& ) = delete;
 
+	void setMode       ( unsigned _mode )  {        rwl_setMode       (this, _mode); }
 	void reset         ()                  {        rwl_reset         (this); }
 	void kill          ()                  {        rwl_kill          (this); }
 	void destroy       ()                  {        rwl_destroy       (this); }
@@ -510,6 +636,10 @@ struct RWLock : public __rwl
 	int  lockWrite     ()                  { return rwl_lockWrite     (this); }
 	void giveWrite     ()                  {        rwl_giveWrite     (this); }
 	void unlockWrite   ()                  {        rwl_unlockWrite   (this); }
+	template<typename T>
+	int  upgradeFor    ( const T& _delay ) { return rwl_upgradeFor    (this, Clock::count(_delay)); }
+	int  upgrade       ()                  { return rwl_upgrade       (this); }
+	void downgrade     ()                  {        rwl_downgrade     (this); }
 
 #if __cplusplus >= 201402L
 	using Ptr = std::unique_ptr<RWLock>;
@@ -523,7 +653,9 @@ struct RWLock : public __rwl
  *
  * Description       : create dynamic object with manageable resources
  *
- * Parameters        : none
+ * Parameters
+ *   mode            : read/write lock policy: rwlPreferRead or rwlPreferWrite or rwlPhaseFair
+ *                     none: rwlDefault
  *
  * Return            : std::unique_pointer / pointer to RWLock object
  *
@@ -532,9 +664,9 @@ struct RWLock : public __rwl
  ******************************************************************************/
 
 	static
-	Ptr Create()
+	Ptr Create( const unsigned _mode = rwlDefault )
 	{
-		auto rwl = new (std::nothrow) RWLock();
+		auto rwl = new (std::nothrow) RWLock(_mode);
 		if (rwl != nullptr)
 			rwl->__rwl::obj.res = rwl;
 		return Ptr(rwl);
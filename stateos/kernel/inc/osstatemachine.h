@@ -38,6 +38,22 @@
 
 /* -------------------------------------------------------------------------- */
 
+#ifndef OS_HSM_URGENT
+#define OS_HSM_URGENT     0 /* size of the urgent event lane of the hsm (0: disabled) */
+#endif
+
+#ifndef OS_HSM_DEFER
+#define OS_HSM_DEFER      0 /* max number of deferred events of the hsm (0: disabled) */
+#endif
+
+#if     OS_HSM_DEFER && OS_HSM_URGENT == 0
+#error  osconfig.h: OS_HSM_DEFER requires OS_HSM_URGENT! Deferred events are recalled through the urgent lane.
+#endif
+
+#define HSM_LIMIT     (sizeof(unsigned) * CHAR_BIT) // number of user events that can be coalesced
+
+/* -------------------------------------------------------------------------- */
+
 enum
 {
 	hsmALL = 0,// the state action applies to all events
@@ -126,6 +142,11 @@ typedef struct __hsm_action hsm_action_id [];
  *
  * Name              : hierarchical state machine - definition
  *
+ * Description       : user events from hsmUser to hsmUser + HSM_LIMIT - 1 can be coalesced:
+ *                     coalesced event is not posted again while it is pending
+ *                     urgent events (OS_HSM_URGENT > 0) are dispatched before the events of the event queue
+ *                     deferred events (OS_HSM_DEFER > 0) are recalled to the urgent lane after each state transition
+ *
  ******************************************************************************/
 
 struct __hsm
@@ -133,6 +154,18 @@ struct __hsm
 	evq_t           evq;     // event queue
 	hsm_state_t *   state;   // current hsm state
 	hsm_action_t *  action;  // current hsm state action
+	unsigned        coalesce;// mask of coalesced user events
+	unsigned        pending; // mask of coalesced user events waiting for dispatch
+#if OS_HSM_URGENT
+	unsigned        ucount;  // number of urgent events
+	unsigned        uhead;   // first urgent event to dispatch
+	unsigned        urgent[OS_HSM_URGENT]; // urgent event lane
+#endif
+#if OS_HSM_DEFER
+	unsigned        dcount;  // number of deferred events
+	unsigned        dhead;   // first deferred event to recall
+	unsigned        defer[OS_HSM_DEFER];   // deferred events
+#endif
 };
 
 typedef struct __hsm hsm_id [];
@@ -325,7 +358,19 @@ typedef struct __hsm hsm_id [];
  ******************************************************************************/
 
 #define               _HSM_INIT( _limit, _data ) \
-                    { _EVQ_INIT( _limit, _data ), NULL, NULL }
+                    { _EVQ_INIT( _limit, _data ), NULL, NULL, 0, 0 _HSM_URGENT_INIT() _HSM_DEFER_INIT() }
+
+#if OS_HSM_URGENT
+#define               _HSM_URGENT_INIT() , 0, 0, { 0 }
+#else
+#define               _HSM_URGENT_INIT()
+#endif
+
+#if OS_HSM_DEFER
+#define               _HSM_DEFER_INIT()  , 0, 0, { 0 }
+#else
+#define               _HSM_DEFER_INIT()
+#endif
 
 /******************************************************************************
  *
@@ -484,6 +529,25 @@ hsm_t *hsm_new( unsigned limit ) { return hsm_create(limit); }
 
 void hsm_link( hsm_action_t *action );
 
+/******************************************************************************
+ *
+ * Name              : hsm_coalesce
+ *
+ * Description       : enable coalescing of the user event:
+ *                     the event is not posted to the hsm while the same event is pending
+ *
+ * Parameters
+ *   hsm             : pointer to hsm object
+ *   event           : user event value (from hsmUser to hsmUser + HSM_LIMIT - 1)
+ *
+ * Return            : none
+ *
+ * Note              : Async aliases of posting functions don't coalesce events
+ *
+ ******************************************************************************/
+
+void hsm_coalesce( hsm_t *hsm, unsigned event );
+
 /******************************************************************************
  *
  * Name              : hsm_start
@@ -562,7 +626,7 @@ void hsm_delete( hsm_t *hsm ) { hsm_destroy(hsm); }
  *   event           : event value
  *
  * Return
- *   E_SUCCESS       : event data was successfully transferred to the hsm object
+ *   E_SUCCESS       : event data was successfully transferred to the hsm object or the coalesced event is pending
  *   E_TIMEOUT       : hsm event queue is full, try again
  *
  * Note              : can be used in both thread and handler mode
@@ -580,6 +644,61 @@ int hsm_giveISR( hsm_t *hsm, unsigned event ) { return hsm_give(hsm, event); }
 int hsm_giveAsync( hsm_t *hsm, unsigned event );
 #endif
 
+/******************************************************************************
+ *
+ * Name              : hsm_giveUrgent
+ * ISR alias         : hsm_giveUrgentISR
+ *
+ * Description       : try to transfer event data to the urgent lane of the hsm,
+ *                     urgent events are dispatched before the events of the hsm event queue,
+ *                     don't wait if the urgent lane is full
+ *
+ * Parameters
+ *   hsm             : pointer to hsm object
+ *   event           : event value
+ *
+ * Return
+ *   E_SUCCESS       : event data was successfully transferred to the hsm object or the coalesced event is pending
+ *   E_TIMEOUT       : urgent lane is full, try again
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     use ISR alias in blockable interrupt handlers
+ *                     available if OS_HSM_URGENT > 0
+ *
+ ******************************************************************************/
+
+#if OS_HSM_URGENT
+
+int hsm_giveUrgent( hsm_t *hsm, unsigned event );
+
+__STATIC_INLINE
+int hsm_giveUrgentISR( hsm_t *hsm, unsigned event ) { return hsm_giveUrgent(hsm, event); }
+
+#endif
+
+/******************************************************************************
+ *
+ * Name              : hsm_defer
+ *
+ * Description       : defer the event; it is recalled to the urgent lane after the next state transition
+ *                     remove the oldest deferred event if there is no space for deferred events
+ *
+ * Parameters
+ *   hsm             : pointer to hsm object
+ *   event           : event value
+ *
+ * Return            : none
+ *
+ * Note              : use as the event handler of the state action, e.g.:
+ *                     OS_HSM_ACTION(state, event, NULL, hsm_defer);
+ *                     available if OS_HSM_DEFER > 0
+ *
+ ******************************************************************************/
+
+#if OS_HSM_DEFER
+void hsm_defer( hsm_t *hsm, unsigned event );
+#endif
+
 /******************************************************************************
  *
  * Name              : hsm_sendFor
@@ -595,7 +714,7 @@ int hsm_giveAsync( hsm_t *hsm, unsigned event );
  *                     INFINITE:  wait indefinitely while the hsm event queue is full
  *
  * Return
- *   E_SUCCESS       : event value was successfully transferred to the hsm object
+ *   E_SUCCESS       : event value was successfully transferred to the hsm object or the coalesced event is pending
  *   E_STOPPED       : hsm object was reseted before the specified timeout expired
  *   E_DELETED       : hsm object was deleted before the specified timeout expired
  *   E_TIMEOUT       : hsm event queue is full and was not issued data before the specified timeout expired
@@ -619,7 +738,7 @@ int hsm_sendFor( hsm_t *hsm, unsigned event, cnt_t delay );
  *   time            : timepoint value
  *
  * Return
- *   E_SUCCESS       : event value was successfully transferred to the hsm object
+ *   E_SUCCESS       : event value was successfully transferred to the hsm object or the coalesced event is pending
  *   E_STOPPED       : hsm object was reseted before the specified timeout expired
  *   E_DELETED       : hsm object was deleted before the specified timeout expired
  *   E_TIMEOUT       : hsm event queue is full and was not issued data before the specified timeout expired
@@ -643,7 +762,7 @@ int hsm_sendUntil( hsm_t *hsm, unsigned event, cnt_t time );
  *   event           : event value
  *
  * Return
- *   E_SUCCESS       : event data was successfully transferred to the hsm object
+ *   E_SUCCESS       : event data was successfully transferred to the hsm object or the coalesced event is pending
  *   E_STOPPED       : hsm object was reseted (unavailable for async version)
  *   E_DELETED       : hsm object was deleted (unavailable for async version)
  *
@@ -766,7 +885,7 @@ struct Action : public __hsm_action
 #if __cplusplus >= 201402L
 	static
 	void handler_( hsm_t *_hsm, unsigned _event ) { static_cast<Action*>(_hsm->action)->handler(_hsm, _event); }
-	std::function<void( hsm_t *, unsigned )> handler;
+	baseFunction<void( hsm_t *, unsigned )> handler;
 #endif
 
 	private:
@@ -804,11 +923,16 @@ struct StateMachineT : public __hsm
 	void          add       ( const std::vector<Action>& _tab )   {        std::copy(std::begin(_tab), std::end(_tab), std::back_inserter(tab_)); }
 	void          start     ( tsk_t& _task, hsm_state_t& _init )  {        for (auto& _action: tab_) _action.link();
 	                                                                       hsm_start     (this, &_task, &_init); }
+	void          coalesce  ( unsigned _event )                   {        hsm_coalesce  (this,  _event); }
 	void          reset     ()                                    {        hsm_reset     (this); }
 	void          kill      ()                                    {        hsm_kill      (this); }
 	void          destroy   ()                                    {        hsm_destroy   (this); }
 	int           give      ( unsigned _event )                   { return hsm_give      (this,  _event); }
 	int           giveISR   ( unsigned _event )                   { return hsm_giveISR   (this,  _event); }
+#if OS_HSM_URGENT
+	int           giveUrgent( unsigned _event )                   { return hsm_giveUrgent(this,  _event); }
+	int        giveUrgentISR( unsigned _event )                   { return hsm_giveUrgentISR(this, _event); }
+#endif
 	template<typename T>
 	int           sendFor   ( unsigned _event, const T& _delay )  { return hsm_sendFor  (this,   _event, Clock::count(_delay)); }
 	template<typename T>
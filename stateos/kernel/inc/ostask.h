@@ -48,6 +48,12 @@
 #define STK_CROP( base, size ) \
          LIMITED((size_t)( base ) + (size_t)( size ), sizeof(stk_t))
 
+/* -------------------------------------------------------------------------- */
+
+/////// scheduling policy
+#define tskRR            0U // round-robin: the task shares the processor with ready tasks of the same priority in time slices
+#define tskFIFO          1U // first in, first out: the task runs until it blocks, yields or is preempted by a task of higher priority
+
 /******************************************************************************
  *
  * Name              : task (thread)
@@ -68,6 +74,7 @@ struct __tsk
 	stk_t  * stack; // base of stack
 	size_t   size;  // size of stack (in bytes)
 	void   * sp;    // current stack pointer
+	bool     shared;// basic task: runs to completion on the stack shared with other basic tasks of the same priority
 
 	unsigned basic; // basic priority
 	unsigned prio;  // current priority
@@ -76,6 +83,44 @@ struct __tsk
 	tsk_t ** guard; // BLOCKED queue for the pending process
 	int      event; // wakeup event
 
+#if OS_EDF_PRIO
+	struct {
+	cnt_t    period;  // release period of the task (0: task without deadline)
+	cnt_t    deadline;// deadline relative to the release time
+	cnt_t    release; // release time of the current job
+	unsigned miss;    // number of missed deadlines
+	}        edf;
+#define _EDF_INIT() { 0, 0, 0, 0 },
+#else
+#define _EDF_INIT()
+#endif
+
+#if OS_TASK_BUDGET
+	struct {
+	cnt_t    budget;  // execution time granted in each replenishment period (0: unlimited)
+	cnt_t    period;  // replenishment period
+	cnt_t    release; // start of the current replenishment period
+	cnt_t    used;    // execution time used in the current replenishment period
+	unsigned prio;    // priority of the task while its budget is exhausted
+	unsigned basic;   // basic priority of the throttled task
+	unsigned count;   // number of budget exhaustions
+	tsk_t  * next;    // next task in the list of throttled tasks
+	}        bgt;
+#define _BGT_INIT() { 0, 0, 0, 0, 0, 0, 0, NULL },
+#else
+#define _BGT_INIT()
+#endif
+
+#if OS_ROBIN
+	struct {
+	unsigned policy;  // scheduling policy: tskRR or tskFIFO
+	cnt_t    quantum; // time slice of the round-robin policy (0: default, (OS_FREQUENCY)/(OS_ROBIN))
+	}        sch;
+#define _SCH_INIT() { tskRR, 0 },
+#else
+#define _SCH_INIT()
+#endif
+
 	struct {
 	mtx_t  * list;  // list of mutexes held
 	mtx_t  * tree;  // tree of tasks waiting for mutexes
@@ -175,8 +220,31 @@ typedef struct __tsk tsk_id [];
  ******************************************************************************/
 
 #define               _TSK_INIT( _prio, _proc, _stack, _size )                                                            \
-                       { _OBJ_INIT(), _HDR_INIT(), _proc, NULL, 0, 0, 0, _stack, _size, NULL, _prio, _prio, NULL, NULL, 0, \
-                       { NULL, NULL }, { 0, NULL, { NULL, NULL } }, { { 0 } }, _PORT_DATA_INIT() }
+                       { _OBJ_INIT(), _HDR_INIT(), _proc, NULL, 0, 0, 0, _stack, _size, NULL, false, _prio, _prio, NULL, NULL, 0, \
+                       _EDF_INIT() _BGT_INIT() _SCH_INIT() { NULL, NULL }, { 0, NULL, { NULL, NULL } }, { { 0 } }, _PORT_DATA_INIT() }
+
+/******************************************************************************
+ *
+ * Name              : _BAS_INIT
+ *
+ * Description       : create and initialize a basic task object
+ *
+ * Parameters
+ *   prio            : initial task priority (any unsigned int value)
+ *   proc            : task proc (initial task function) doesn't have to be noreturn-type
+ *                     the task is stopped when the task proc returns
+ *   stack           : base of the stack shared by basic tasks of the priority 'prio'
+ *   size            : size of the shared stack (in bytes)
+ *
+ * Return            : task object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _BAS_INIT( _prio, _proc, _stack, _size )                                                            \
+                       { _OBJ_INIT(), _HDR_INIT(), _proc, NULL, 0, 0, 0, _stack, _size, NULL, true, _prio, _prio, NULL, NULL, 0, \
+                       _EDF_INIT() _BGT_INIT() _SCH_INIT() { NULL, NULL }, { 0, NULL, { NULL, NULL } }, { { 0 } }, _PORT_DATA_INIT() }
 
 /******************************************************************************
  *
@@ -252,6 +320,60 @@ typedef struct __tsk tsk_id [];
                 static stk_t tsk##__stk[STK_SIZE( size )] __STKALIGN; \
                 static tsk_t tsk[] = { _TSK_INIT( prio, proc, tsk##__stk, STK_OVER( size ) ) }
 
+/******************************************************************************
+ *
+ * Name              : OS_WRK_FAST
+ * Static alias      : static_WRK_FAST
+ *
+ * Description       : define and initialize complete work area for task object placed in the fast memory
+ *
+ * Parameters
+ *   tsk             : name of a pointer to task object
+ *   prio            : initial task priority (any unsigned int value)
+ *   proc            : task proc (initial task function) doesn't have to be noreturn-type
+ *                     it will be executed into an infinite system-implemented loop
+ *   size            : size of task private stack (in bytes)
+ *
+ * Note              : task object and its stack are placed in the fast memory (DTCM / CCM) if OS_FAST_MEMORY is set
+ *                     CCM is not accessible by DMA
+ *
+ ******************************************************************************/
+
+#define             OS_WRK_FAST( tsk, prio, proc, size )                          \
+                static stk_t tsk##__stk[STK_SIZE( size )] __STKALIGN __FASTSTK; \
+                       tsk_t tsk[] __FASTDATA = { _TSK_INIT( prio, proc, tsk##__stk, STK_OVER( size ) ) }
+
+#define         static_WRK_FAST( tsk, prio, proc, size )                          \
+                static stk_t tsk##__stk[STK_SIZE( size )] __STKALIGN __FASTSTK; \
+                static tsk_t tsk[] __FASTDATA = { _TSK_INIT( prio, proc, tsk##__stk, STK_OVER( size ) ) }
+
+/******************************************************************************
+ *
+ * Name              : OS_BAS
+ * Static alias      : static_BAS
+ *
+ * Description       : define and initialize basic task object (run-to-completion task)
+ *                     all basic tasks of the same priority can share one stack
+ *
+ * Parameters
+ *   tsk             : name of a pointer to task object
+ *   prio            : initial task priority (any unsigned int value)
+ *   proc            : task proc (initial task function) doesn't have to be noreturn-type
+ *                     the task is stopped when the task proc returns
+ *   stk             : name of the shared stack (defined with OS_TSK_STACK)
+ *
+ * Note              : basic task must not block, yield or change its priority (tsk_setPrio, tsk_setBudget)
+ *                     the priority may be raised temporarily by the kernel (priority inheritance / protection)
+ *                     it is preempted only by tasks of higher priority
+ *
+ ******************************************************************************/
+
+#define             OS_BAS( tsk, prio, proc, stk ) \
+                       tsk_t tsk[] = { _BAS_INIT( prio, proc, stk, sizeof(stk) ) }
+
+#define         static_BAS( tsk, prio, proc, stk ) \
+                static tsk_t tsk[] = { _BAS_INIT( prio, proc, stk, sizeof(stk) ) }
+
 /******************************************************************************
  *
  * Name              : OS_TSK
@@ -274,6 +396,31 @@ typedef struct __tsk tsk_id [];
 #define         static_TSK( tsk, prio, proc, ... ) \
                 static_WRK( tsk, prio, proc, _VA_STK(__VA_ARGS__) )
 
+/******************************************************************************
+ *
+ * Name              : OS_TSK_FAST
+ * Static alias      : static_TSK_FAST
+ *
+ * Description       : define and initialize complete work area for task object placed in the fast memory with default stack size
+ *
+ * Parameters
+ *   tsk             : name of a pointer to task object
+ *   prio            : initial task priority (any unsigned int value)
+ *   proc            : task proc (initial task function) doesn't have to be noreturn-type
+ *                     it will be executed into an infinite system-implemented loop
+ *   size            : (optional) size of task private stack (in bytes); default: OS_STACK_SIZE
+ *
+ * Note              : task object and its stack are placed in the fast memory (DTCM / CCM) if OS_FAST_MEMORY is set
+ *                     CCM is not accessible by DMA
+ *
+ ******************************************************************************/
+
+#define             OS_TSK_FAST( tsk, prio, proc, ... ) \
+                    OS_WRK_FAST( tsk, prio, proc, _VA_STK(__VA_ARGS__) )
+
+#define         static_TSK_FAST( tsk, prio, proc, ... ) \
+                static_WRK_FAST( tsk, prio, proc, _VA_STK(__VA_ARGS__) )
+
 /******************************************************************************
  *
  * Name              : OS_WRK_DEF
@@ -529,6 +676,35 @@ tsk_t *cur_task( void ) { return System.cur; }
 
 void wrk_init( tsk_t *tsk, unsigned prio, fun_t *proc, stk_t *stack, size_t size );
 
+/******************************************************************************
+ *
+ * Name              : bas_init
+ *
+ * Description       : initialize basic task object (run-to-completion task)
+ *                     all basic tasks of the same priority can share one stack
+ *                     don't start the task
+ *
+ * Parameters
+ *   tsk             : pointer to task object
+ *   prio            : initial task priority (any unsigned int value)
+ *   proc            : task proc (initial task function) doesn't have to be noreturn-type
+ *                     the task is stopped when the task proc returns
+ *   stack           : base of the stack shared by basic tasks of the priority 'prio'
+ *   size            : size of the shared stack (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     basic task must not block, yield or change its priority (tsk_setPrio, tsk_setBudget)
+ *                     the priority may be raised temporarily by the kernel (priority inheritance / protection)
+ *                     it is preempted only by tasks of higher priority
+ *                     started basic task is kept ahead of the ready tasks of the same priority
+ *                     context of basic task is created on the shared stack when the task is scheduled for the first time
+ *
+ ******************************************************************************/
+
+void bas_init( tsk_t *tsk, unsigned prio, fun_t *proc, stk_t *stack, size_t size );
+
 /******************************************************************************
  *
  * Name              : tsk_init
@@ -604,6 +780,56 @@ tsk_t *wrk_new( unsigned prio, fun_t *proc, size_t size, bool detached, bool aut
 
 tsk_t *tsk_setup( unsigned prio, fun_a *proc, void *arg, size_t size );
 
+/******************************************************************************
+ *
+ * Name              : tsk_submit
+ *
+ * Description       : execute the procedure in a new detached task with given stack size
+ *                     a parked worker of the same stack size class is used, if available
+ *
+ * Parameters
+ *   prio            : initial task priority (any unsigned int value)
+ *   proc            : procedure to be executed once
+ *   arg             : procedure argument
+ *   size            : size of task private stack (in bytes)
+ *
+ * Return
+ *   E_SUCCESS       : procedure has been submitted for execution
+ *   E_FAILURE       : not enough free memory
+ *
+ * Note              : use only in thread mode
+ *                     the worker is parked again after the procedure returns (if OS_TASK_POOL > 0)
+ *
+ ******************************************************************************/
+
+int tsk_submit( unsigned prio, fun_a *proc, void *arg, size_t size );
+
+/******************************************************************************
+ *
+ * Name              : tsk_reserve
+ *
+ * Description       : create parked workers with given stack size
+ *                     dynamic tasks of the same stack size class are started on parked workers
+ *                     without allocating memory; workers of detached tasks are parked again
+ *                     when the task ends, workers of joinable tasks when the task is joined
+ *
+ * Parameters
+ *   count           : number of workers to create
+ *   size            : size of task private stack (in bytes)
+ *
+ * Return            : number of created workers (limited by OS_TASK_POOL and free memory)
+ *
+ * Note              : use only in thread mode
+ *                     available only if OS_TASK_POOL > 0
+ *
+ ******************************************************************************/
+
+#if OS_TASK_POOL
+
+unsigned tsk_reserve( unsigned count, size_t size );
+
+#endif
+
 /******************************************************************************
  *
  * Name              : tsk_create
@@ -886,6 +1112,203 @@ void tsk_setPrio( unsigned prio );
 __STATIC_INLINE
 void tsk_prio( unsigned prio ) { tsk_setPrio(prio); }
 
+/******************************************************************************
+ *
+ * Name              : tsk_setPeriod
+ *
+ * Description       : make the current task a periodic task of the EDF class
+ *                     the task gets the OS_EDF_PRIO priority, the current job is released now
+ *                     tasks of the EDF class are ordered by absolute deadline (release time + deadline)
+ *
+ * Parameters
+ *   period          : release period of the task
+ *   deadline        : deadline relative to the release time of the job
+ *                     0: deadline is equal to the period
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     available only if OS_EDF_PRIO > 0
+ *
+ ******************************************************************************/
+
+#if OS_EDF_PRIO
+
+void tsk_setPeriod( cnt_t period, cnt_t deadline );
+
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tsk_waitPeriod
+ *
+ * Description       : finish the current job of the periodic task and delay execution of the task
+ *                     until the release time of the next job (the end of the period)
+ *                     if the next job is already released, the task continues immediately
+ *
+ * Parameters        : none
+ *
+ * Return
+ *   E_SUCCESS       : the finished job met its deadline
+ *   E_FAILURE       : the finished job missed its deadline
+ *
+ * Note              : use only in thread mode
+ *                     available only if OS_EDF_PRIO > 0
+ *
+ ******************************************************************************/
+
+#if OS_EDF_PRIO
+
+int tsk_waitPeriod( void );
+
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tsk_getMisses
+ *
+ * Description       : get number of deadlines missed by the periodic task
+ *
+ * Parameters
+ *   tsk             : pointer to task object
+ *
+ * Return            : number of missed deadlines
+ *
+ * Note              : available only if OS_EDF_PRIO > 0
+ *
+ ******************************************************************************/
+
+#if OS_EDF_PRIO
+
+unsigned tsk_getMisses( tsk_t *tsk );
+
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tsk_setBudget
+ *
+ * Description       : set execution budget of the task (deferrable server)
+ *                     the task can execute for 'budget' time in each replenishment period
+ *                     the task that exhausted its budget is throttled: its basic priority is lowered to 'prio'
+ *                     until the start of the next replenishment period
+ *
+ * Parameters
+ *   tsk             : pointer to task object
+ *   budget          : execution time granted in each replenishment period
+ *                     0: unlimited (the budget is removed)
+ *   period          : replenishment period
+ *   prio            : priority of the task while its budget is exhausted
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     available only if OS_TASK_BUDGET > 0
+ *                     execution time is sampled at the system tick
+ *                     the throttled task is preempted at once only in the preemptive mode (OS_ROBIN > 0)
+ *
+ ******************************************************************************/
+
+#if OS_TASK_BUDGET
+
+void tsk_setBudget( tsk_t *tsk, cnt_t budget, cnt_t period, unsigned prio );
+
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tsk_getOverruns
+ *
+ * Description       : get number of budget exhaustions of the task
+ *
+ * Parameters
+ *   tsk             : pointer to task object
+ *
+ * Return            : number of budget exhaustions
+ *
+ * Note              : available only if OS_TASK_BUDGET > 0
+ *
+ ******************************************************************************/
+
+#if OS_TASK_BUDGET
+
+unsigned tsk_getOverruns( tsk_t *tsk );
+
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tsk_budgetHook
+ *
+ * Description       : set the supervisor procedure notified when any task exhausts its budget
+ *
+ * Parameters
+ *   hook            : supervisor procedure called with the throttled task as parameter
+ *                     NULL: no notification
+ *
+ * Return            : none
+ *
+ * Note              : the supervisor procedure is executed in the interrupt context of the system tick
+ *                     available only if OS_TASK_BUDGET > 0
+ *
+ ******************************************************************************/
+
+#if OS_TASK_BUDGET
+
+void tsk_budgetHook( void (*hook)( tsk_t * ) );
+
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tsk_setPolicy
+ *
+ * Description       : set scheduling policy and time slice of the task
+ *
+ * Parameters
+ *   tsk             : pointer to task object
+ *   policy          : scheduling policy
+ *                     tskRR:   round-robin, the task is moved behind ready tasks of the same priority when its time slice expires
+ *                     tskFIFO: first in, first out, the task is never preempted by tasks of the same priority
+ *   quantum         : time slice of the round-robin policy
+ *                     0: default time slice, (OS_FREQUENCY)/(OS_ROBIN)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     available only if OS_ROBIN > 0
+ *                     it can be used before the task is started
+ *                     in tick-less mode the time slice is rounded up to a multiple of (OS_FREQUENCY)/(OS_ROBIN)
+ *
+ ******************************************************************************/
+
+#if OS_ROBIN
+
+void tsk_setPolicy( tsk_t *tsk, unsigned policy, cnt_t quantum );
+
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tsk_getPolicy
+ *
+ * Description       : get scheduling policy of the task
+ *
+ * Parameters
+ *   tsk             : pointer to task object
+ *
+ * Return            : scheduling policy (tskRR or tskFIFO)
+ *
+ * Note              : available only if OS_ROBIN > 0
+ *
+ ******************************************************************************/
+
+#if OS_ROBIN
+
+unsigned tsk_getPolicy( tsk_t *tsk );
+
+#endif
+
 /******************************************************************************
  *
  * Name              : tsk_getPrio
@@ -1074,14 +1497,14 @@ void tsk_action( tsk_t *tsk, act_t *action );
  * Parameters        : none
  *
  * Return            : high water mark of the stack of the current task
- *   0               : DEBUG not defined
+ *   0               : neither DEBUG nor OS_STACK_PROFILE defined
  *
  ******************************************************************************/
 
 __STATIC_INLINE
 size_t tsk_stackSpace( void )
 {
-#ifdef DEBUG
+#if OS_STACK_FILL
 	return core_stk_space(System.cur);
 #else
 	return 0;
@@ -1140,17 +1563,17 @@ struct baseStack
 
 struct baseTask : public __tsk
 {
+	constexpr
+	baseTask( const unsigned _prio, fun_t * _proc, stk_t * const _stack, const size_t _size ): __tsk _TSK_INIT(_prio, _proc, _stack, _size) {}
 #if __cplusplus >= 201402L
 	template<class F>
 	baseTask( const unsigned _prio, F&&     _proc, stk_t * const _stack, const size_t _size ): __tsk _TSK_INIT(_prio, fun_, _stack, _size), fun{_proc} {}
-#else
-	baseTask( const unsigned _prio, fun_t * _proc, stk_t * const _stack, const size_t _size ): __tsk _TSK_INIT(_prio, _proc, _stack, _size) {}
 #endif
 
 	void     start    ()                   {        tsk_start    (this); }
 #if __cplusplus >= 201402L
 	template<class F>
-	void     startFrom( F&&      _proc )   {        new (&fun) Fun_t(_proc);
+	void     startFrom( F&&      _proc )   {        fun = _proc;
 	                                                tsk_startFrom(this, fun_); }
 #else
 	void     startFrom( fun_t  * _proc )   {        tsk_startFrom(this, _proc); }
@@ -1162,6 +1585,21 @@ struct baseTask : public __tsk
 	int      destroy  ()                   { return tsk_destroy  (this); }
 	unsigned prio     ()                   { return __tsk::basic; }
 	unsigned getPrio  ()                   { return __tsk::basic; }
+#if OS_EDF_PRIO
+	unsigned getMisses()                   { return tsk_getMisses(this); }
+#endif
+#if OS_TASK_BUDGET
+	template<typename T>
+	void     setBudget( const T& _budget, const T& _period, unsigned _prio = 0 )
+	                                       {        tsk_setBudget(this, Clock::count(_budget), Clock::count(_period), _prio); }
+	unsigned getOverruns()                 { return tsk_getOverruns(this); }
+#endif
+#if OS_ROBIN
+	template<typename T = cnt_t>
+	void     setPolicy( unsigned _policy, const T& _quantum = T() )
+	                                       {        tsk_setPolicy(this, _policy, Clock::count(_quantum)); }
+	unsigned getPolicy()                   { return tsk_getPolicy(this); }
+#endif
 	int      suspend  ()                   { return tsk_suspend  (this); }
 	int      resume   ()                   { return tsk_resume   (this); }
 	int      resumeISR()                   { return tsk_resumeISR(this); }
@@ -1169,7 +1607,7 @@ struct baseTask : public __tsk
 	void     signal   ( unsigned _signo )  {        tsk_signal   (this, _signo); }
 #if __cplusplus >= 201402L
 	template<class F>
-	void     action   ( F&&      _action ) {        new (&act) Act_t(_action);
+	void     action   ( F&&      _action ) {        act = _action;
 	                                                tsk_action   (this, act_); }
 #else
 	void     action   ( act_t *  _action ) {        tsk_action   (this, _action); }
@@ -1183,10 +1621,10 @@ struct baseTask : public __tsk
 #if __cplusplus >= 201402L
 	static
 	void     fun_     ()                   {        current()->fun(); }
-	Fun_t    fun;
+	baseFunction<void( void )> fun;
 	static
 	void     act_     ( unsigned _signo )  {        current()->act(_signo); }
-	Act_t    act;
+	baseFunction<void( unsigned )> act;
 #endif
 
 /******************************************************************************
@@ -1217,7 +1655,7 @@ struct baseTask : public __tsk
 		void     pass      ()                   {        tsk_pass      (); }
 #if __cplusplus >= 201402L
 		template<class F> static
-		void     flip      ( F&&      _proc )   {        new (&current()->fun) Fun_t(_proc);
+		void     flip      ( F&&      _proc )   {        current()->fun = _proc;
 		                                                 tsk_flip      (fun_); }
 #else
 		static
@@ -1231,6 +1669,13 @@ struct baseTask : public __tsk
 		unsigned getPrio   ()                   { return tsk_getPrio   (); }
 		static
 		unsigned prio      ()                   { return tsk_getPrio   (); }
+#if OS_EDF_PRIO
+		template<typename T> static
+		void     setPeriod ( const T& _period, const T& _deadline = T() )
+		                                        {        tsk_setPeriod (Clock::count(_period), Clock::count(_deadline)); }
+		static
+		int      waitPeriod()                   { return tsk_waitPeriod(); }
+#endif
 		template<typename T> static
 		void     sleepFor  ( const T& _delay )  {        tsk_sleepFor  (Clock::count(_delay)); }
 		template<typename T> static
@@ -1249,7 +1694,7 @@ struct baseTask : public __tsk
 		void     signal    ( unsigned _signo )  {        tsk_signal    (current(), _signo); }
 #if __cplusplus >= 201402L
 		template<class F> static
-		void     action    ( F&&      _action ) {        new (&current()->act) Act_t(_action);
+		void     action    ( F&&      _action ) {        current()->act = _action;
 		                                                 tsk_action    (current(), act_); }
 #else
 		static
@@ -1278,6 +1723,14 @@ using this_task = baseTask::Current;
 template<size_t size_>
 struct TaskT : public baseTask, public baseStack<size_>
 {
+	_CONSTEXPR
+	TaskT( const unsigned _prio, fun_t * _proc ):
+	baseTask{_prio, _proc, baseStack<size_>::stack_, sizeof(baseStack<size_>::stack_)} _CONSTINIT(baseStack<size_>) {}
+
+	_CONSTEXPR
+	TaskT( fun_t * _proc ):
+	TaskT<size_>{OS_MAIN_PRIO, _proc} {}
+
 	template<class F>
 	TaskT( const unsigned _prio, F&& _proc ):
 	baseTask{_prio, _proc, baseStack<size_>::stack_, sizeof(baseStack<size_>::stack_)} {}
@@ -1512,6 +1965,71 @@ struct TaskT : public baseTask, public baseStack<size_>
 	}
 #endif
 #endif
+
+/******************************************************************************
+ *
+ * Name              : TaskT<>::Submit
+ *
+ * Description       : execute the procedure in a new detached task
+ *                     a parked worker of the same stack size class is used, if available
+ *
+ * Parameters
+ *   size            : size of task private stack (in bytes)
+ *   prio            : initial task priority (any unsigned int value)
+ *   proc            : procedure to be executed once
+ *   args            : arguments for the procedure
+ *
+ * Return
+ *   E_SUCCESS       : procedure has been submitted for execution
+ *   E_FAILURE       : not enough free memory
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+#if __cplusplus >= 201402L
+	template<class F> static
+	int Submit( const unsigned _prio, F&& _proc )
+	{
+		auto job = new (std::nothrow) baseFunction<void( void )>(std::forward<F>(_proc));
+		if (job == nullptr)
+			return E_FAILURE;
+		int result = tsk_submit(_prio, job_, job, size_);
+		if (result != E_SUCCESS)
+			delete job;
+		return result;
+	}
+
+	template<class F> static
+	int Submit( F&& _proc )
+	{
+		return Submit(OS_MAIN_PRIO, std::forward<F>(_proc));
+	}
+
+	template<typename F, typename... A> static
+	int Submit( const unsigned _prio, F&& _proc, A&&... _args )
+	{
+		return Submit(_prio, std::bind(std::forward<F>(_proc), std::forward<A>(_args)...));
+	}
+
+#if __cplusplus >= 201703L && !defined(__ICCARM__)
+	template<typename F, typename... A, typename = std::enable_if_t<std::is_invocable_v<F, A...>>> static
+	int Submit( F&& _proc, A&&... _args )
+	{
+		return Submit(std::bind(std::forward<F>(_proc), std::forward<A>(_args)...));
+	}
+#endif
+
+	private:
+
+	static
+	void job_( void *_job )
+	{
+		auto job = static_cast<baseFunction<void( void )> *>(_job);
+		(*job)();
+		delete job;
+	}
+#endif
 };
 
 /******************************************************************************
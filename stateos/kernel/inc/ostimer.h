@@ -51,6 +51,9 @@ struct __tmr
 	cnt_t    start;
 	cnt_t    delay;
 	cnt_t    period;
+#if OS_TIMER_TASK
+	bool     isr;   // callback procedure is executed in the interrupt context
+#endif
 };
 
 typedef struct __tmr tmr_id [];
@@ -71,8 +74,13 @@ typedef struct __tmr tmr_id [];
  *
  ******************************************************************************/
 
+#if OS_TIMER_TASK
+#define               _TMR_INIT( _proc ) \
+                    { _OBJ_INIT(), _HDR_INIT(), _proc, NULL, 0, 0, 0, false }
+#else
 #define               _TMR_INIT( _proc ) \
                     { _OBJ_INIT(), _HDR_INIT(), _proc, NULL, 0, 0, 0 }
+#endif
 
 /******************************************************************************
  *
@@ -249,8 +257,13 @@ extern "C" {
  *
  ******************************************************************************/
 
+#if OS_TIMER_TASK
+__STATIC_INLINE
+tmr_t *tmr_thisISR( void ) { return System.tmr; }
+#else
 __STATIC_INLINE
 tmr_t *tmr_thisISR( void ) { return (tmr_t *) WAIT.hdr.next; }
+#endif
 
 /******************************************************************************
  *
@@ -313,6 +326,28 @@ tmr_t *tmr_new( fun_t *proc ) { return tmr_create(proc); }
 
 tmr_t *tmr_setup( fun_t *proc, void *arg );
 
+/******************************************************************************
+ *
+ * Name              : tmr_setISR
+ *
+ * Description       : select the context in which the timer callback procedure is executed
+ *
+ * Parameters
+ *   tmr             : pointer to timer object
+ *   isr             : true:  callback procedure is executed in the interrupt context
+ *                     false: callback procedure is executed by the timer service task
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     available only when the timer service task is enabled (OS_TIMER_TASK)
+ *
+ ******************************************************************************/
+
+#if OS_TIMER_TASK
+void tmr_setISR( tmr_t *tmr, bool isr );
+#endif
+
 /******************************************************************************
  *
  * Name              : tmr_reset
@@ -703,12 +738,13 @@ namespace stateos {
 
 struct baseTimer : public __tmr
 {
+	constexpr
 	baseTimer(): __tmr _TMR_INIT(nullptr) {}
+	constexpr
+	baseTimer( fun_t *_proc ): __tmr _TMR_INIT(_proc) {}
 #if __cplusplus >= 201402L
 	template<class F>
 	baseTimer( F&& _proc ): __tmr _TMR_INIT(fun_), fun{_proc} {}
-#else
-	baseTimer( fun_t *_proc ): __tmr _TMR_INIT(_proc) {}
 #endif
 
 	void reset        ()                                                    {        tmr_reset        (this); }
@@ -728,13 +764,16 @@ struct baseTimer : public __tmr
 	template<typename T>
 	void startFrom    ( const T& _delay, const T& _period, std::nullptr_t ) {        tmr_startFrom    (this, Clock::count(_delay), Clock::count(_period), nullptr); }
 	template<typename T, class F>
-	void startFrom    ( const T& _delay, const T& _period, F&&     _proc )  {        new (&fun) Fun_t(_proc);
+	void startFrom    ( const T& _delay, const T& _period, F&&     _proc )  {        fun = _proc;
 	                                                                                 tmr_startFrom    (this, Clock::count(_delay), Clock::count(_period), fun_); }
 #else
 	template<typename T>
 	void startFrom    ( const T& _delay, const T& _period, fun_t * _proc )  {        tmr_startFrom    (this, Clock::count(_delay), Clock::count(_period), _proc); }
 #endif
 	void stop         ()                                                    {        tmr_stop         (this); }
+#if OS_TIMER_TASK
+	void setISR       ( bool _isr )                                         {        tmr_setISR       (this, _isr); }
+#endif
 	int  take         ()                                                    { return tmr_take         (this); }
 	int  expired      ()                                                    { return tmr_expired      (this); }
 	int  tryWait      ()                                                    { return tmr_tryWait      (this); }
@@ -755,7 +794,7 @@ struct baseTimer : public __tmr
 #if __cplusplus >= 201402L
 	static
 	void fun_         ()                                                    {        current()->fun(); }
-	Fun_t fun;
+	baseFunction<void( void )> fun;
 #endif
 
 /******************************************************************************
@@ -772,7 +811,7 @@ struct baseTimer : public __tmr
 		static
 		void flipISR ( std::nullptr_t )            { tmr_flipISR (nullptr); }
 		template<class F> static
-		void flipISR ( F&& _proc )                 { new (&current()->fun) Fun_t(_proc);
+		void flipISR ( F&& _proc )                 { current()->fun = _proc;
 		                                             tmr_flipISR (fun_); }
 		template<typename F, typename... A> static
 		void flipISR ( F&& _proc, A&&... _args )   { flipISR(std::bind(std::forward<F>(_proc), std::forward<A>(_args)...)); }
@@ -802,10 +841,14 @@ using this_timer = baseTimer::Current;
 
 struct Timer : public baseTimer
 {
+	constexpr
 	Timer(): baseTimer{} {}
+	constexpr
+	Timer( fun_t * _proc ): baseTimer{_proc} {}
 	template<class F>
 	Timer( F&& _proc ): baseTimer{_proc} {}
 #if __cplusplus >= 201402L
+	constexpr
 	Timer( std::nullptr_t ): baseTimer{} {}
 	template<typename F, typename... A>
 	Timer( F&& _proc, A&&... _args ): baseTimer{std::bind(std::forward<F>(_proc), std::forward<A>(_args)...)} {}
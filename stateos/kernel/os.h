@@ -52,6 +52,7 @@
 #include "inc/osmemorypool.h"
 #include "inc/osrawbuffer.h"
 #include "inc/osmessagequeue.h"
+#include "inc/oschannel.h"
 #include "inc/osmailboxqueue.h"
 #include "inc/oseventqueue.h"
 #include "inc/osjobqueue.h"
@@ -66,6 +66,113 @@ extern "C" {
 
 /* -------------------------------------------------------------------------- */
 
+#ifndef OS_TIMER_TASK
+#define OS_TIMER_TASK     0 /* timer callbacks are executed in the interrupt context */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_TASK_CACHE
+#define OS_TASK_CACHE     0 /* number of released dynamic tasks kept for reuse in each stack size class */
+#endif
+
+#ifndef OS_TASK_POOL
+#define OS_TASK_POOL      0 /* number of parked workers (dynamic tasks kept alive for reuse), the pool is shared by all stack size classes */
+#endif
+
+#ifndef OS_TASK_CLASSES
+#define OS_TASK_CLASSES   1 /* stack size classes: OS_STACK_SIZE, 2*OS_STACK_SIZE, 4*OS_STACK_SIZE, 8*OS_STACK_SIZE */
+#endif
+
+#if     OS_TASK_CLASSES < 1 || OS_TASK_CLASSES > 4
+#error  osconfig.h: Invalid OS_TASK_CLASSES value! It must be a value from 1 to 4.
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_EDF_PRIO
+#define OS_EDF_PRIO       0 /* priority of the EDF class; its tasks are ordered by absolute deadline (0: disabled) */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_TASK_BUDGET
+#define OS_TASK_BUDGET    0 /* per-task execution budgets enforced at the system tick */
+#endif
+
+#if     OS_TASK_BUDGET && HW_TIMER_SIZE
+#error  osconfig.h: OS_TASK_BUDGET requires the tick mode (HW_TIMER_SIZE == 0)!
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_TICK_SUPPRESS
+#define OS_TICK_SUPPRESS  0 /* the idle task suppresses the system tick until the next timeout (if supported by the port) */
+#endif
+
+#if     OS_TICK_SUPPRESS && HW_TIMER_SIZE
+#error  osconfig.h: OS_TICK_SUPPRESS requires the tick mode (HW_TIMER_SIZE == 0)!
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+// robust mutexes always use the kernel lock; any other mutex taken without it stays locked when its owner is killed
+#ifndef OS_MUTEX_FAST
+#define OS_MUTEX_FAST     0 /* uncontended mutexes are taken and given without the kernel lock (if supported by the port) */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_MSG_PACKED
+#define OS_MSG_PACKED     0 /* messages are packed back-to-back in the message queue buffer; capacity is counted in bytes */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_CONSTINIT
+#define OS_CONSTINIT      0 /* C++ objects with buffers (task stacks, queues, pools) can be constant-initialized; the whole object is placed in .data */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_STACK_PROFILE
+#define OS_STACK_PROFILE  0 /* number of tasks (including MAIN and IDLE) recorded by the stack profiler (0: disabled) */
+#endif
+
+#ifndef OS_STACK_MARGIN
+#define OS_STACK_MARGIN  25 /* safety margin of the stack sizes recommended by the stack profiler (in percent) */
+#endif
+
+#if     OS_STACK_PROFILE == 1
+#error  osconfig.h: Invalid OS_STACK_PROFILE value! It must be 0 or a value greater than 1.
+#endif
+
+#if     OS_STACK_PROFILE || defined(DEBUG)
+#define OS_STACK_FILL     1 /* stacks of tasks are filled with 0xFF to measure the high water mark */
+#else
+#define OS_STACK_FILL     0
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_FAST_MEMORY
+#define OS_FAST_MEMORY    0 /* place the hot kernel code, kernel data and stacks in the fast memory (if supported by the port) */
+#endif
+
+#ifndef __FASTCODE
+#define __FASTCODE
+#endif
+
+#ifndef __FASTDATA
+#define __FASTDATA
+#endif
+
+#ifndef __FASTSTK
+#define __FASTSTK
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 #ifndef OS_GUARD_SIZE
 #define OS_GUARD_SIZE     0
 #endif
@@ -181,6 +288,23 @@ void core_obj_init( obj_t *obj, void *res )
 
 /* -------------------------------------------------------------------------- */
 
+// request to resume tasks waiting on an object queue, posted by an unmasked interrupt handler
+
+#if OS_ATOMICS
+
+typedef struct __ntf
+{
+	struct __ntf * next; // next pending request; NULL if the request is not pending
+	obj_t        * obj;  // object whose waiting tasks are to be resumed
+
+}	ntf_t;
+
+#define               _NTF_INIT() { NULL, NULL }
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 // timer / task header
 
 typedef struct __hdr
@@ -209,6 +333,9 @@ typedef struct __sys
 {
 	tsk_t  * cur;   // pointer to the current task control block
 	tsk_t  * tsk;	// task executed in system suspend mode
+#if OS_TIMER_TASK
+	tmr_t  * tmr;   // timer whose callback procedure is being executed
+#endif
 #if HW_TIMER_SIZE < OS_TIMER_SIZE
 	volatile
 	cnt_t    cnt;   // system timer counter
@@ -218,6 +345,24 @@ typedef struct __sys
 
 /* -------------------------------------------------------------------------- */
 
+// stack profiler record
+
+#if OS_STACK_PROFILE
+
+typedef struct __stp
+{
+	tsk_t  * tsk;   // profiled task
+	fun_t  * proc;  // the last procedure of the profiled task
+	size_t   size;  // size of the stack (in bytes), 0 if unknown
+	size_t   used;  // the highest recorded stack usage (in bytes)
+	bool     live;  // the task object is still valid and its stack can be sampled
+
+}	stp_t;
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 #if (OS_FREQUENCY)/1000000 > 0 && (OS_FREQUENCY)/1000000 < (CNT_MAX)
 #define USEC       (cnt_t)((OS_FREQUENCY)/1000000)
 #endif
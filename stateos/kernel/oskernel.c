@@ -131,6 +131,8 @@ void core_tmr_remove( tmr_t *tmr )
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_TIMER_TASK == 0
+
 static
 void priv_tmr_wakeup( tmr_t *tmr, int event )
 {
@@ -146,6 +148,90 @@ void priv_tmr_wakeup( tmr_t *tmr, int event )
 
 /* -------------------------------------------------------------------------- */
 
+#else
+
+static tmr_t TIMERS = { .hdr={ .prev=&TIMERS, .next=&TIMERS, .id=ID_TIMER } }; // expired timers queue
+
+static
+void priv_tmr_wakeup( tmr_t *tmr, int event )
+{
+	tmr_t *prv;
+
+	if (tmr->proc && !tmr->isr)  // defer callback to the timer service task
+	{
+		priv_tmr_remove(tmr);
+
+		prv = TIMERS.hdr.prev;
+
+		tmr->hdr.id   = ID_TIMER;
+		tmr->hdr.prev = prv;
+		tmr->hdr.next = &TIMERS;
+		TIMERS.hdr.prev = tmr;
+		prv->hdr.next = tmr;
+
+		core_one_wakeup(&TIMERS.obj.queue, event);
+		return;
+	}
+
+	if (tmr->proc)
+	{
+		prv = System.tmr;
+		System.tmr = tmr;
+		((fun_a *)tmr->proc)(tmr->arg);
+		System.tmr = prv;
+	}
+
+	priv_tmr_remove(tmr);
+	if (tmr->delay >= core_sys_time() - tmr->start + 1)
+		priv_tmr_insert(tmr);
+
+	core_all_wakeup(&tmr->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_service( void )
+{
+	tmr_t *tmr;
+
+	port_set_lock();
+
+	for (;;) // never return: with OS_TASK_EXIT the task would be stopped
+	{
+		while (tmr = TIMERS.hdr.next, tmr != &TIMERS)
+		{
+			System.tmr = tmr;
+
+			port_clr_lock();
+			((fun_a *)tmr->proc)(tmr->arg);
+			port_set_lock();
+
+			if (tmr == TIMERS.hdr.next) // timer has not been stopped or restarted by the callback procedure
+			{
+				priv_tmr_remove(tmr);
+				if (tmr->delay > 0)
+				{
+					while (tmr->delay < core_sys_time() - tmr->start + 1)
+						tmr->start += tmr->delay; // skip overdue periods
+					core_tmr_insert(tmr);
+				}
+
+				core_all_wakeup(&tmr->obj.queue, E_SUCCESS);
+			}
+		}
+
+		System.tmr = NULL;
+
+		System.cur->delay = INFINITE;
+		core_tsk_wait(&TIMERS.obj.queue, System.cur);
+	}
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+__FASTCODE
 void core_tmr_handler( void )
 {
 	tmr_t *tmr;
@@ -175,17 +261,52 @@ void core_tmr_handler( void )
 // SYSTEM TASK SERVICES
 /* -------------------------------------------------------------------------- */
 
+#if OS_EDF_PRIO
+
+// tasks of the EDF priority are ordered by absolute deadline
+// tasks of the EDF priority without deadline (e.g. inheriting the priority) precede them
 static
-void priv_tsk_insert( tsk_t *tsk )
+bool priv_tsk_ahead( tsk_t *tsk, tsk_t *nxt )
+{
+	if (tsk->prio != OS_EDF_PRIO || nxt->edf.period == 0)
+		return true;
+
+	if (tsk->edf.period == 0)
+		return false;
+
+	return (cnt_t)(tsk->edf.release + tsk->edf.deadline - nxt->edf.release - nxt->edf.deadline) <= CNT_MAX / 2;
+}
+
+#else
+
+#define priv_tsk_ahead( tsk, nxt ) true
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+// basic task, whose context is already on the shared stack, is placed ahead of the tasks of the same priority
+// otherwise another basic task of this priority could be started on the shared stack
+
+static
+bool priv_tsk_first( tsk_t *tsk )
+{
+	return tsk->shared && (tsk == System.cur || tsk->sp != 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_merge( tsk_t *tsk, tsk_t *nxt )
 {
 	tsk_t *prv;
-	tsk_t *nxt = &IDLE;
-	#if OS_ROBIN && HW_TIMER_SIZE == 0
+	bool first = priv_tsk_first(tsk);
+	#if OS_ROBIN
 	tsk->slice = 0;
 	#endif
-	if (tsk->prio)
+	if (tsk->prio || first)
 		do nxt = nxt->hdr.next;
-		while (tsk->prio <= nxt->prio);
+		while (tsk->prio < nxt->prio || (tsk->prio == nxt->prio && !first && priv_tsk_ahead(tsk, nxt)));
 
 	tsk->hdr.id = ID_READY;
 
@@ -199,6 +320,14 @@ void priv_tsk_insert( tsk_t *tsk )
 
 /* -------------------------------------------------------------------------- */
 
+static
+void priv_tsk_insert( tsk_t *tsk )
+{
+	priv_tsk_merge(tsk, &IDLE);
+}
+
+/* -------------------------------------------------------------------------- */
+
 static
 void priv_tsk_remove( tsk_t *tsk )
 {
@@ -237,10 +366,13 @@ void core_tsk_remove( tsk_t *tsk )
 
 /* -------------------------------------------------------------------------- */
 
-void core_ctx_init( tsk_t *tsk )
+static
+void priv_ctx_init( tsk_t *tsk )
 {
-	assert(tsk->size>STK_OVER(sizeof(ctx_t)));
-	#ifdef DEBUG
+	#if OS_STACK_PROFILE
+	core_stk_release(tsk); // record the previous activation of the task
+	#endif
+	#if OS_STACK_FILL
 	if (tsk != System.cur)
 		memset(tsk->stack, 0xFF, tsk->size - sizeof(ctx_t));
 	#endif
@@ -248,12 +380,26 @@ void core_ctx_init( tsk_t *tsk )
 	#if OS_TASK_EXIT
 	port_ctx_init(tsk->sp, core_tsk_exec);
 	#else
-	port_ctx_init(tsk->sp, core_tsk_loop);
+	port_ctx_init(tsk->sp, tsk->shared ? core_tsk_exec : core_tsk_loop);
+	#endif
+	#if OS_STACK_PROFILE
+	core_stk_sample(tsk);
 	#endif
 }
 
+void core_ctx_init( tsk_t *tsk )
+{
+	assert(tsk->size>STK_OVER(sizeof(ctx_t)));
+	// the shared stack may still be in use by another basic task of the same priority,
+	// so the context of the basic task is created when the task is switched in for the first time
+	if (tsk->shared && tsk != System.cur)
+		tsk->sp = 0;
+	else
+		priv_ctx_init(tsk);
+}
+
 /* -------------------------------------------------------------------------- */
-#ifdef DEBUG
+#if OS_STACK_FILL
 
 size_t core_stk_space( tsk_t *tsk )
 {
@@ -263,6 +409,119 @@ size_t core_stk_space( tsk_t *tsk )
 	return (uintptr_t)ptr - (uintptr_t)stk;
 }
 
+#endif
+/* -------------------------------------------------------------------------- */
+#if OS_STACK_PROFILE
+
+static
+void priv_stk_sample( stp_t *rec )
+{
+	tsk_t *tsk = rec->tsk;
+	size_t used = tsk->size - core_stk_space(tsk);
+
+	rec->proc = tsk->proc;
+	if (rec->size < tsk->size)
+		rec->size = tsk->size;
+	if (rec->used < used)
+		rec->used = used;
+}
+
+// the record of a released task object has no task (tsk == NULL), but keeps the task proc;
+// it is shared by all released tasks of the proc, the empty record has no proc also
+
+static
+stp_t *priv_stk_record( tsk_t *tsk, fun_t *proc )
+{
+	stp_t *rec;
+
+	for (rec = StackProfile; rec < StackProfile + OS_STACK_PROFILE; rec++)
+		if (rec->tsk == tsk && (tsk != NULL || rec->proc == proc))
+			return rec;
+
+	return NULL;
+}
+
+void core_stk_sample( tsk_t *tsk )
+{
+	stp_t *rec = priv_stk_record(tsk, NULL);
+
+	if (rec == NULL)
+		rec = priv_stk_record(NULL, tsk->proc); // take over the record of released tasks of the proc
+	if (rec == NULL)
+		rec = priv_stk_record(NULL, NULL);      // register the task
+	if (rec == NULL)
+		return;                                 // no free records
+
+	rec->tsk  = tsk;
+	rec->live = true;
+	priv_stk_sample(rec);
+}
+
+void core_stk_main( void *sp )
+{
+	size_t used = (uintptr_t)MAIN.stack - (uintptr_t)sp;
+
+	if (StackProfile[0].used < used)
+		StackProfile[0].used = used;
+}
+
+void core_stk_release( tsk_t *tsk )
+{
+	stp_t *rec = priv_stk_record(tsk, NULL);
+
+	if (rec != NULL && rec->live)
+	{
+		priv_stk_sample(rec);
+		rec->live = false;
+	}
+}
+
+void core_stk_free( tsk_t *tsk )
+{
+	stp_t *rec = priv_stk_record(tsk, NULL);
+	stp_t *dst;
+
+	if (rec == NULL)
+		return;
+
+	if (rec->live)
+		priv_stk_sample(rec);
+
+	dst = priv_stk_record(NULL, rec->proc);
+	if (dst != NULL)                         // merge with the record of released tasks of the proc
+	{
+		if (dst->size < rec->size)
+			dst->size = rec->size;
+		if (dst->used < rec->used)
+			dst->used = rec->used;
+		*rec = (stp_t){ 0 };
+	}
+	else
+	{
+		rec->tsk  = NULL;
+		rec->live = false;
+	}
+}
+
+void core_stk_profile( void )
+{
+	static
+	unsigned idx = 0;
+
+	port_set_lock();
+	{
+		if (++idx >= OS_STACK_PROFILE)
+			idx = 1; // MAIN is sampled while switching context
+		if (StackProfile[idx].live)
+			priv_stk_sample(&StackProfile[idx]);
+	}
+	port_clr_lock();
+}
+
+#endif
+/* -------------------------------------------------------------------------- */
+#ifdef DEBUG
+
 static
 bool priv_stk_integrity( tsk_t *tsk, void *tp, void *sp)
 {
@@ -333,7 +592,6 @@ void core_tsk_loop( void )
 }
 
 /* -------------------------------------------------------------------------- */
-#if OS_TASK_EXIT
 
 void core_tsk_exec( void )
 {
@@ -342,7 +600,6 @@ void core_tsk_exec( void )
 	tsk_stop();
 }
 
-#endif
 /* -------------------------------------------------------------------------- */
 
 void core_tsk_append( tsk_t **que, tsk_t *tsk )
@@ -374,6 +631,7 @@ void core_tsk_unlink( tsk_t *tsk, int event )
 
 /* -------------------------------------------------------------------------- */
 
+__FASTCODE
 void core_tsk_wakeup( tsk_t *tsk, int event )
 {
 	if (tsk)
@@ -394,9 +652,21 @@ void core_tsk_transfer( tsk_t **que, tsk_t *tsk )
 
 /* -------------------------------------------------------------------------- */
 
+void core_tsk_requeue( tsk_t **que, tsk_t *tsk )
+{
+	core_tsk_transfer(que, tsk);
+	priv_tmr_remove((tmr_t *)tsk); // sets ID_STOPPED
+	tsk->delay = INFINITE;
+	priv_tmr_insert((tmr_t *)tsk); // sets ID_TIMER
+	tsk->hdr.id = ID_READY;        // sets ID_READY back
+}
+
+/* -------------------------------------------------------------------------- */
+
 int core_tsk_wait( tsk_t **que, tsk_t *tsk )
 {
 	assert_tsk_context();
+	assert(!tsk->shared);
 
 	if (que)
 	{
@@ -487,6 +757,7 @@ tsk_t *priv_one_wakeup( tsk_t **que, int event )
 
 /* -------------------------------------------------------------------------- */
 
+__FASTCODE
 tsk_t *core_one_wakeup( tsk_t **que, int event )
 {
 	tsk_t *tsk = priv_one_wakeup(que, event);
@@ -504,9 +775,33 @@ tsk_t *core_one_wakeup( tsk_t **que, int event )
 
 unsigned core_num_wakeup( tsk_t **que, int event, unsigned num )
 {
+	tsk_t *tsk;
+	tsk_t *prv = &IDLE;
+	tsk_t *fst = NULL;
 	unsigned cnt = 0;
 
-	while (num > 0 && core_one_wakeup(que, event)) { cnt++; num--; }
+	// blocked queue is sorted by priority, so the tasks are merged into
+	// the READY queue in one pass, starting from the previously inserted task
+	while (num > 0 && (tsk = priv_one_wakeup(que, event)) != NULL)
+	{
+		priv_tmr_remove((tmr_t *)tsk);
+		if (tsk->prio == 0 || tsk->prio > prv->prio)
+			prv = &IDLE;
+		#if OS_EDF_PRIO
+		if (tsk->prio == OS_EDF_PRIO) // tasks of the EDF priority are not sorted by deadline in the blocked queue
+			prv = &IDLE;
+		#endif
+		priv_tsk_merge(tsk, prv);
+		if (fst == NULL)
+			fst = tsk;
+		prv = tsk;
+		cnt++; num--;
+	}
+
+	#if OS_ROBIN
+	if (fst != NULL && fst == IDLE.hdr.next && System.tsk == NULL)
+		port_ctx_switch();
+	#endif
 
 	return cnt;
 }
@@ -515,7 +810,7 @@ unsigned core_num_wakeup( tsk_t **que, int event, unsigned num )
 
 void core_all_wakeup( tsk_t **que, int event )
 {
-	while (core_one_wakeup(que, event));
+	core_num_wakeup(que, event, UINT_MAX);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -599,6 +894,54 @@ void core_cur_prio( unsigned prio )
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_EDF_PRIO
+
+void core_cur_deadline( void )
+{
+	tsk_t *tsk = System.cur;
+
+	if (tsk->prio == OS_EDF_PRIO)
+	{
+		priv_tsk_remove(tsk);
+		priv_tsk_insert(tsk);
+		#if OS_ROBIN
+		if (tsk != IDLE.hdr.next && System.tsk == NULL)
+			port_ctx_switch();
+		#endif
+	}
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_ROBIN
+
+// the time slice of the task of the round-robin policy has expired
+static
+bool priv_tsk_expired( tsk_t *tsk )
+{
+	if (tsk->sch.policy == tskFIFO)
+		return false;
+
+	return tsk->slice >= (tsk->sch.quantum ? tsk->sch.quantum : (cnt_t)((OS_FREQUENCY)/(OS_ROBIN)));
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_slice( cnt_t ticks )
+{
+	tsk_t *cur = System.cur;
+
+	cur->slice += ticks;
+	if (priv_tsk_expired(cur))
+		core_ctx_switch();
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 static
 tsk_t *priv_tsk_switch( tsk_t *cur )
 {
@@ -606,8 +949,8 @@ tsk_t *priv_tsk_switch( tsk_t *cur )
 
 	nxt = IDLE.hdr.next;
 
-	#if OS_ROBIN && HW_TIMER_SIZE == 0
-	if (cur == nxt || (nxt->slice >= (OS_FREQUENCY)/(OS_ROBIN) && (nxt->slice = 0) == 0))
+	#if OS_ROBIN
+	if (cur == nxt || (priv_tsk_expired(nxt) && (nxt->slice = 0) == 0))
 	#else
 	if (cur == nxt)
 	#endif
@@ -625,6 +968,7 @@ tsk_t *priv_tsk_switch( tsk_t *cur )
 
 /* -------------------------------------------------------------------------- */
 
+__FASTCODE
 void *core_tsk_switch( void *sp )
 {
 	tsk_t *cur;
@@ -639,8 +983,20 @@ void *core_tsk_switch( void *sp )
 		if (cur->sp == 0)
 			cur->sp = sp;
 
+		#if OS_STACK_PROFILE
+		if (cur == &MAIN)
+			core_stk_main(sp);
+		#endif
+
+		#if OS_ATOMICS
+		core_async_dispatch();
+		#endif
+
 		cur = priv_tsk_switch(cur);
 
+		if (cur->sp == 0 && cur->shared) // basic task switched in for the first time
+			priv_ctx_init(cur);
+
 		System.cur = cur;
 		sp = cur->sp;
 		cur->sp = 0;
@@ -670,6 +1026,9 @@ void core_mtx_link( mtx_t *mtx, tsk_t *tsk )
 
 	if (tsk)
 	{
+		#if OS_MUTEX_FAST
+		mtx->mode |= mtxLinked;
+		#endif
 		mtx->list = tsk->mtx.list;
 		tsk->mtx.list = mtx;
 	}
@@ -677,6 +1036,23 @@ void core_mtx_link( mtx_t *mtx, tsk_t *tsk )
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_MUTEX_FAST
+
+// the mutex taken without the kernel lock is not on the list of mutexes held by its owner
+// it is linked when the first task is going to wait for it
+void core_mtx_attach( mtx_t *mtx )
+{
+	assert(mtx);
+	assert(mtx->owner);
+
+	if ((mtx->mode & mtxLinked) == 0)
+		core_mtx_link(mtx, mtx->owner);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 void core_mtx_unlink( mtx_t *mtx )
 {
 	tsk_t *tsk;
@@ -698,6 +1074,9 @@ void core_mtx_unlink( mtx_t *mtx )
 		mtx->list  = 0;
 		mtx->owner = 0;
 		mtx->count = 0;
+		#if OS_MUTEX_FAST
+		mtx->mode &= ~mtxLinked;
+		#endif
 
 		core_tsk_prio(tsk, tsk->basic);
 	}
@@ -724,17 +1103,125 @@ void core_mtx_reset( mtx_t *mtx, int event )
 	core_all_wakeup(&mtx->obj.queue, event);
 }
 
+/* -------------------------------------------------------------------------- */
+// SYSTEM BUDGET SERVICES
+/* -------------------------------------------------------------------------- */
+
+#if OS_TASK_BUDGET
+
+static
+tsk_t *Throttled = NULL; // list of tasks that exhausted their budgets
+
+static
+void (* BudgetHook)( tsk_t * ) = NULL;
+
+void core_bgt_hook( void (*hook)( tsk_t * ) )
+{
+	BudgetHook = hook;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_bgt_replenish( tsk_t *tsk )
+{
+	cnt_t periods = (cnt_t)(core_sys_time() - tsk->bgt.release) / tsk->bgt.period;
+
+	tsk->bgt.release += (cnt_t)(periods * tsk->bgt.period);
+	tsk->bgt.used = 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_bgt_restore( tsk_t *tsk )
+{
+	tsk->basic = tsk->bgt.basic;
+	core_tsk_prio(tsk, tsk->basic);
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_bgt_remove( tsk_t *tsk )
+{
+	tsk_t **lst;
+
+	for (lst = &Throttled; *lst; lst = &(*lst)->bgt.next)
+	{
+		if (*lst == tsk)
+		{
+			*lst = tsk->bgt.next;
+			priv_bgt_restore(tsk);
+			break;
+		}
+	}
+
+	tsk->bgt.used = 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_bgt_tick( void )
+{
+	tsk_t **lst = &Throttled;
+	tsk_t  *tsk;
+
+	port_set_lock();
+	{
+		// throttled tasks get their basic priorities back at the start of the next period
+		while ((tsk = *lst) != NULL)
+		{
+			if ((cnt_t)(core_sys_time() - tsk->bgt.release) >= tsk->bgt.period)
+			{
+				*lst = tsk->bgt.next;
+				priv_bgt_replenish(tsk);
+				priv_bgt_restore(tsk);
+			}
+			else
+				lst = &tsk->bgt.next;
+		}
+
+		// the current task is charged for the whole tick
+		tsk = System.cur;
+
+		if (tsk->bgt.budget != 0 && tsk->bgt.used < tsk->bgt.budget)
+		{
+			if ((cnt_t)(core_sys_time() - tsk->bgt.release) >= tsk->bgt.period)
+				priv_bgt_replenish(tsk);
+
+			if (++tsk->bgt.used >= tsk->bgt.budget)
+			{
+				tsk->bgt.count++;
+				tsk->bgt.basic = tsk->basic;
+				tsk->bgt.next = Throttled;
+				Throttled = tsk;
+				tsk->basic = tsk->bgt.prio;
+				core_tsk_prio(tsk, tsk->basic);
+				if (BudgetHook)
+					BudgetHook(tsk);
+			}
+		}
+	}
+	port_clr_lock();
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #if HW_TIMER_SIZE == 0
 
+__FASTCODE
 void core_sys_tick( void )
 {
 	System.cnt++;
 	core_tmr_handler();
+	#if OS_TASK_BUDGET
+	priv_bgt_tick();
+	#endif
 	#if OS_ROBIN
-	if (++System.cur->slice >= (OS_FREQUENCY)/(OS_ROBIN))
-		core_ctx_switch();
+	core_tsk_slice(1);
 	#endif
 }
 
@@ -742,9 +1229,63 @@ void core_sys_tick( void )
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_TICK_SUPPRESS
+
+static
+void priv_sys_sleep( void )
+{
+	tmr_t *tmr;
+	cnt_t  ticks = 0;
+	cnt_t  time;
+
+	port_set_lock();
+	{
+		// the tick can be suppressed only if the idle task is the only ready task
+		if (IDLE.hdr.next == &IDLE && System.tsk == NULL)
+		{
+			tmr = WAIT.hdr.next;
+			time = core_sys_time() - tmr->start;
+			if (tmr->delay == INFINITE)
+				ticks = INFINITE;
+			else
+			if (tmr->delay > time)
+				ticks = tmr->delay - time;
+		}
+
+		// the tick handler counts the last tick and wakes up the timers and tasks
+		if (ticks > 1)
+			System.cnt += port_tck_sleep(ticks);
+	}
+	port_clr_lock();
+
+	if (ticks <= 1)
+		__WFI();
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 void core_tsk_idle( void )
 {
+	#if OS_STACK_PROFILE
+	core_stk_profile();
+	#endif
+	#if OS_TICK_SUPPRESS
+	priv_sys_sleep();
+	#else
 	__WFI();
+	#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+bool (* ResHook)( void * ) = NULL;
+
+void core_res_hook( bool (*proc)( void * ) )
+{
+	ResHook = proc;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -755,12 +1296,208 @@ void core_res_free( obj_t *obj )
 	if (ptr != NULL && ptr != RELEASED)
 	{
 		obj->res = RELEASED;
-		free(ptr);
+		if (ResHook == NULL || !ResHook(ptr))
+	#if OS_MALLOC_MUTEX
+			port_free(ptr); // the allocator mutex cannot be waited for here
+	#else
+			free(ptr);
+	#endif
 	}
 }
 
 /* -------------------------------------------------------------------------- */
 
+struct tsk_T { tsk_t tsk; stk_t buf[]; };
+
+#if OS_TASK_CACHE || OS_TASK_POOL
+
+#define TSK_CLASS_SIZE(cls) STK_OVER((size_t)(OS_STACK_SIZE) << (cls))
+
+static
+int priv_tsk_class( size_t size )
+{
+	int cls;
+
+	for (cls = 0; cls < OS_TASK_CLASSES; cls++)
+		if (size <= TSK_CLASS_SIZE(cls))
+			return cls;
+
+	return -1;
+}
+
+// task object has been allocated by core_tsk_alloc with the stack of a size class
+static
+bool priv_tsk_classed( tsk_t *tsk )
+{
+	int cls = priv_tsk_class(tsk->size);
+
+	return tsk->obj.res == tsk &&
+	       tsk->stack == ((struct tsk_T *)tsk)->buf &&
+	       cls >= 0 && tsk->size == TSK_CLASS_SIZE(cls);
+}
+
+#endif
+
+#if OS_TASK_CACHE
+
+static struct { tsk_t *list; unsigned count; } TaskCache[OS_TASK_CLASSES]; // released task objects
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TASK_POOL
+
+static struct { tsk_t *queue; unsigned count; } TaskPool; // parked workers
+
+bool core_tsk_park( tsk_t *tsk )
+{
+	if (!priv_tsk_classed(tsk) || TaskPool.count >= OS_TASK_POOL)
+		return false;
+
+	#if OS_STACK_PROFILE
+	core_stk_free(tsk);
+	#endif
+
+	tsk->obj.res = RELEASED;           // parked worker cannot be used by its previous owner
+	tsk->delay = INFINITE;
+	TaskPool.count++;
+
+	if (tsk == System.cur)
+	{
+		core_tsk_wait(&TaskPool.queue, tsk);
+		assert(false);                 // worker is restarted with a new context
+	}
+
+	core_tmr_insert((tmr_t *)tsk);     // sets ID_TIMER
+	tsk->hdr.id = ID_READY;            // sets ID_READY back
+	core_tsk_append(&TaskPool.queue, tsk);
+
+	return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+tsk_t *priv_tsk_unpark( size_t size )
+{
+	tsk_t *tsk;
+
+	for (tsk = TaskPool.queue; tsk; tsk = tsk->obj.queue)
+	{
+		if (tsk->size == size)
+		{
+			core_tsk_unlink(tsk, 0);       // remove worker from the pool; ignored event value
+			core_tmr_remove((tmr_t *)tsk); // remove worker from WAIT queue
+			TaskPool.count--;
+			break;
+		}
+	}
+
+	return tsk;
+}
+
+/* -------------------------------------------------------------------------- */
+
+unsigned core_tsk_reserve( unsigned count, size_t size )
+{
+	struct tsk_T *tmp;
+	unsigned num;
+	int cls = priv_tsk_class(size);
+
+	if (cls < 0)
+		return 0;
+
+	size = TSK_CLASS_SIZE(cls);
+
+	for (num = 0; num < count && TaskPool.count < OS_TASK_POOL; num++)
+	{
+		tmp = malloc(sizeof(struct tsk_T) + size);
+		if (tmp == NULL)
+			break;
+
+		memset(&tmp->tsk, 0, sizeof(tsk_t));
+		core_obj_init(&tmp->tsk.obj, &tmp->tsk);
+		core_hdr_init(&tmp->tsk.hdr);
+		tmp->tsk.stack = tmp->buf;
+		tmp->tsk.size  = size;
+
+		core_tsk_park(&tmp->tsk);
+	}
+
+	return num;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+tsk_t *core_tsk_alloc( stk_t **stack, size_t *size )
+{
+	struct tsk_T *tmp;
+#if OS_TASK_CACHE || OS_TASK_POOL
+	int cls = priv_tsk_class(*size);
+
+	if (cls >= 0)
+	{
+		*size = TSK_CLASS_SIZE(cls);
+#if OS_TASK_POOL
+		tmp = (struct tsk_T *)priv_tsk_unpark(*size);
+		if (tmp)
+		{
+			*stack = tmp->buf;
+			return &tmp->tsk;
+		}
+#endif
+#if OS_TASK_CACHE
+		tmp = (struct tsk_T *)TaskCache[cls].list;
+		if (tmp)
+		{
+			TaskCache[cls].list = tmp->tsk.obj.queue;
+			TaskCache[cls].count--;
+			*stack = tmp->buf;
+			return &tmp->tsk;
+		}
+#endif
+	}
+#endif
+	tmp = malloc(sizeof(struct tsk_T) + *size);
+	if (tmp == NULL)
+		return NULL;
+
+	*stack = tmp->buf;
+	return &tmp->tsk;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_free( tsk_t *tsk )
+{
+#if OS_STACK_PROFILE
+	core_stk_free(tsk);
+#endif
+#if OS_TASK_POOL
+	if (core_tsk_park(tsk))
+		return;
+#endif
+#if OS_TASK_CACHE
+	int cls = priv_tsk_class(tsk->size);
+
+	if (priv_tsk_classed(tsk) &&
+	    TaskCache[cls].count < OS_TASK_CACHE)
+	{
+		tsk->obj.res = RELEASED;
+		tsk->obj.queue = TaskCache[cls].list;
+		TaskCache[cls].list = tsk;
+		TaskCache[cls].count++;
+		return;
+	}
+#endif
+	core_res_free(&tsk->obj);
+}
+
+/* -------------------------------------------------------------------------- */
+
 void core_tsk_deleter( void )
 {
 	tsk_t *tsk;
@@ -769,8 +1506,77 @@ void core_tsk_deleter( void )
 	{
 		core_tsk_unlink(tsk, 0);        // remove task from DESTRUCTOR queue; ignored event value
 		core_tmr_remove((tmr_t *)tsk);  // remove task from WAIT queue
-		core_res_free(&tsk->obj);       // release resources
+		core_tsk_free(tsk);             // release resources
 	}
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_ATOMICS
+
+void core_async_enter( unsigned *state )
+{
+	atomic_fetch_add(state, ASYNC_ACTIVE);
+}
+
+/* -------------------------------------------------------------------------- */
+
+unsigned core_async_leave( unsigned *state )
+{
+	unsigned old = atomic_load(state);
+	unsigned val;
+
+	do
+	{
+		val = old - ASYNC_ACTIVE + 1;
+		assert(old >= ASYNC_ACTIVE && val % ASYNC_ACTIVE > 0);
+	}
+	while (!atomic_compare_exchange_weak(state, &old, val < ASYNC_ACTIVE ? 0 : val));
+
+	return val < ASYNC_ACTIVE ? val : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+ntf_t *Notify = NULL; // list of pending requests
+
+#define NTF_LAST ((ntf_t *)&Notify) // marks the last request as pending
+
+void core_async_notify( ntf_t *ntf, obj_t *obj )
+{
+	ntf_t *nxt = NULL;
+
+	// the request is posted only once until it is dispatched
+	if (!atomic_compare_exchange_strong(&ntf->next, &nxt, NTF_LAST))
+		return;
+
+	ntf->obj = obj;
+	nxt = atomic_load(&Notify);
+	do ntf->next = nxt ? nxt : NTF_LAST;
+	while (!atomic_compare_exchange_weak(&Notify, &nxt, ntf));
+
+	port_ctx_switch();
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_async_dispatch( void )
+{
+	ntf_t *ntf = atomic_exchange(&Notify, NULL);
+	ntf_t *nxt;
+	obj_t *obj;
+
+	while (ntf != NULL && ntf != NTF_LAST)
+	{
+		nxt = ntf->next;
+		obj = ntf->obj;
+		atomic_store(&ntf->next, NULL); // the request can be posted again
+		core_all_wakeup(&obj->queue, E_SUCCESS);
+		ntf = nxt;
+	}
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
@@ -57,6 +57,55 @@
 #include <memory>
 using Fun_t = std::function<void( void )>;
 using Act_t = std::function<void( unsigned )>;
+
+// std::function object constructed on the first assignment
+// the empty object has a constexpr constructor; it allows constant initialization (constinit) of its owner
+// the previous function is not destroyed on assignment, because it can still be executed (flip)
+template<typename T>
+struct baseFunction;
+
+template<typename R, typename... A>
+struct baseFunction<R( A... )>
+{
+	using Fun = std::function<R( A... )>;
+
+	constexpr
+	baseFunction(): none_{}, used_{false} {}
+	template<class F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, baseFunction>::value>>
+	baseFunction( F&& _fun ): fun_{std::forward<F>(_fun)}, used_{true} {}
+	baseFunction( const baseFunction& _src ): used_{_src.used_} { if (used_) new (&fun_) Fun(_src.fun_); }
+	baseFunction( baseFunction&& _src ): used_{_src.used_} { if (used_) new (&fun_) Fun(std::move(_src.fun_)); }
+	~baseFunction() { if (used_) fun_.~Fun(); }
+
+	template<class F>
+	baseFunction& operator=( F&& _fun ) { new (&fun_) Fun(std::forward<F>(_fun)); used_ = true; return *this; }
+	R operator()( A... _args ) const { return fun_(std::forward<A>(_args)...); }
+
+	private:
+
+	union
+	{
+		char none_;
+		Fun  fun_;
+	};
+	bool used_;
+};
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+// the buffer (or stack) of the object is value-initialized only if OS_CONSTINIT is set;
+// then the constexpr constructor allows constant initialization (constinit) of the object,
+// but the whole object with its buffer is placed in .data instead of .bss
+// (the stack is a base of the task object, so the task constructor is constexpr only in this case)
+#if OS_CONSTINIT
+#define _CONSTINIT( buf ) , buf{}
+#define _CONSTEXPR        constexpr
+#else
+#define _CONSTINIT( buf )
+#define _CONSTEXPR
+#endif
 #endif
 
 /* -------------------------------------------------------------------------- */
@@ -90,11 +139,36 @@ extern tmr_t WAIT;   // timers' queue
 extern sys_t System; // system data
 
 /* -------------------------------------------------------------------------- */
-#ifdef DEBUG
+#if OS_STACK_FILL
 
 // return high water mark of stack of the task
 size_t core_stk_space( tsk_t *tsk );
 
+#endif
+/* -------------------------------------------------------------------------- */
+#if OS_STACK_PROFILE
+
+extern stp_t StackProfile[OS_STACK_PROFILE]; // stack profiler records, MAIN and IDLE first
+
+// record the stack usage of the task (tsk) and register the task if necessary
+void core_stk_sample( tsk_t *tsk );
+
+// record the stack usage of the current task (MAIN) at the stack pointer (sp)
+void core_stk_main( void *sp );
+
+// record the stack usage of the task (tsk) that is about to be released
+void core_stk_release( tsk_t *tsk );
+
+// record the stack usage of the task object (tsk) that is about to be freed and release its record
+void core_stk_free( tsk_t *tsk );
+
+// record the stack usage of the next profiled task; it is called by the idle task
+void core_stk_profile( void );
+
+#endif
+/* -------------------------------------------------------------------------- */
+#ifdef DEBUG
+
 // check the integrity of stack of the task while context switching
 bool core_ctx_integrity( tsk_t *tsk, void *sp );
 
@@ -137,10 +211,9 @@ void core_tsk_loop( void );
 // system procedure for starting the current task
 // this is alternative for core_tsk_loop procedure
 // it executes tsk_exit while return
-#if OS_TASK_EXIT
+// it is always used by basic tasks
 __NO_RETURN
 void core_tsk_exec( void );
-#endif
 
 // reset context switch indicator
 __STATIC_INLINE
@@ -160,6 +233,13 @@ void core_tmr_remove( tmr_t *tmr );
 // timers queue handler procedure
 void core_tmr_handler( void );
 
+// timer service task procedure
+// execute callback procedures of expired timers outside the interrupt context
+#if OS_TIMER_TASK
+__NO_RETURN
+void core_tmr_service( void );
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 // reset stack and restart the current task
@@ -189,6 +269,10 @@ void core_tsk_wakeup( tsk_t *tsk, int event );
 // transfer task 'tsk' to the blocked queue 'que'
 void core_tsk_transfer( tsk_t **que, tsk_t *tsk );
 
+// transfer task 'tsk' to the blocked queue 'que'
+// task 'tsk' will wait indefinitely in the blocked queue 'que'
+void core_tsk_requeue( tsk_t **que, tsk_t *tsk );
+
 // delay execution of given task 'tsk'
 // append the current task to the blocked queue 'que'
 // remove the current task from tasks READY queue
@@ -262,6 +346,20 @@ void core_tsk_prio( tsk_t *tsk, unsigned prio );
 // force context switch if new priority of the current task is less then priority of next task in ready queue and kernel works in preemptive mode
 void core_cur_prio( unsigned prio );
 
+#if OS_TASK_BUDGET
+// set the supervisor procedure called when a task exhausts its budget
+void core_bgt_hook( void (*hook)( tsk_t * ) );
+
+// remove task 'tsk' from the list of throttled tasks and restore its basic priority
+void core_bgt_remove( tsk_t *tsk );
+#endif
+
+#if OS_EDF_PRIO
+// update position of the current task in the READY queue after the change of its deadline
+// force context switch if the current task is no longer the first one and kernel works in preemptive mode
+void core_cur_deadline( void );
+#endif
+
 // tasks queue handler procedure
 // save stack pointer 'sp' of the current task
 // reset context switch timer counter
@@ -273,6 +371,17 @@ void *core_tsk_switch( void *sp );
 // set the task 'tsk' as the owner of the mutex 'mtx'
 void core_mtx_link( mtx_t *mtx, tsk_t *tsk );
 
+// link the mutex 'mtx' taken without the kernel lock to the list of mutexes held by its owner
+#if OS_MUTEX_FAST
+void core_mtx_attach( mtx_t *mtx );
+#else
+__STATIC_INLINE
+void core_mtx_attach( mtx_t *mtx )
+{
+	(void) mtx;
+}
+#endif
+
 // remove owner of the mutex 'mtx'
 void core_mtx_unlink( mtx_t *mtx );
 
@@ -315,17 +424,82 @@ void core_sys_tick( void )
 }
 #endif
 
+// suppress the system tick for at most 'ticks' ticks and sleep until any interrupt
+// it is called with the kernel locked and returns the number of ticks that passed and were not counted by the tick handler
+#if OS_TICK_SUPPRESS
+cnt_t port_tck_sleep( cnt_t ticks );
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+// round-robin: charge the current task with 'ticks' of its time slice
+// context switch is forced if the time slice of the task of the round-robin policy has expired
+#if OS_ROBIN
+void core_tsk_slice( cnt_t ticks );
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 // default idle procedure
 void core_tsk_idle( void );
 
+// set procedure used to release resources owned by another allocator; NULL removes it
+// the procedure is called with the kernel locked and returns false for any pointer it does not own,
+// such a pointer is released with free
+void core_res_hook( bool (*proc)( void * ) );
+
 // frees resources of given object
 void core_res_free( obj_t *obj );
 
+// allocate task object together with its private stack of given size 'size'
+// size of the stack is rounded up to the nearest stack size class
+// parked worker (if OS_TASK_POOL > 0) or released task object (if OS_TASK_CACHE > 0) of the same stack size class is reused
+// return pointer to the task object and base of its private stack 'stack'
+tsk_t *core_tsk_alloc( stk_t **stack, size_t *size );
+
+// frees resources of given task object
+// task object allocated by core_tsk_alloc is parked (if OS_TASK_POOL > 0) or kept for reuse (if OS_TASK_CACHE > 0)
+void core_tsk_free( tsk_t *tsk );
+
+#if OS_TASK_POOL
+
+// park given task object allocated by core_tsk_alloc in the pool of workers
+// current task never returns from this function if it has been parked
+// return false if the task object cannot be parked (the pool is full)
+bool core_tsk_park( tsk_t *tsk );
+
+// create up to 'count' parked workers with private stacks of given size 'size'
+// return number of created workers
+unsigned core_tsk_reserve( unsigned count, size_t size );
+
+#endif
+
 // garbage collection procedure
 void core_tsk_deleter( void );
 
+#if OS_ATOMICS
+
+// state of one side (producers / consumers) of a lock-free queue:
+// number of active operations in the high half and of finished, not yet committed ones in the low half
+#define ASYNC_ACTIVE ( 1U << 16 )
+
+// register an active lock-free operation in 'state'
+// the operation must have already claimed its element, so only successful operations are registered
+void core_async_enter( unsigned *state );
+
+// unregister a completed lock-free operation from 'state'
+// return the number of completed operations that can be committed (0 if any operation is still active)
+unsigned core_async_leave( unsigned *state );
+
+// post request 'ntf' to resume all tasks waiting on the object 'obj' and force context switch
+// lock-free; it can be used in unmasked interrupt handlers, that cannot touch the kernel queues
+void core_async_notify( ntf_t *ntf, obj_t *obj );
+
+// resume tasks of all pending requests; called with the kernel locked
+void core_async_dispatch( void );
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #ifdef __cplusplus
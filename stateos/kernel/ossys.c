@@ -33,27 +33,67 @@
 #include "inc/ostimer.h"
 #include "inc/ostask.h"
 #include "inc/osonceflag.h"
+#if OS_STACK_PROFILE
+#include <stdio.h>
+#include <stdarg.h>
+#endif
 
 /* -------------------------------------------------------------------------- */
 
 #ifndef MAIN_TOP
-static  stk_t     MAIN_STK[STK_SIZE(OS_STACK_SIZE)] __STKALIGN;
-#define MAIN_TOP (MAIN_STK+STK_SIZE(OS_STACK_SIZE))
+#ifndef OS_MAIN_STACK
+#define OS_MAIN_STACK OS_STACK_SIZE
+#endif
+static  stk_t     MAIN_STK[STK_SIZE(OS_MAIN_STACK)] __STKALIGN __FASTSTK;
+#define MAIN_TOP (MAIN_STK+STK_SIZE(OS_MAIN_STACK))
 #endif
 
 static  union  { stk_t STK[STK_SIZE(OS_IDLE_STACK)] __STKALIGN;
         struct { char  stk[STK_OVER(OS_IDLE_STACK)-sizeof(ctx_t)]; ctx_t ctx; } CTX; }
-        IDLE_STACK = { .CTX = { .ctx = _CTX_INIT(core_tsk_loop) } };
+        IDLE_STACK __FASTDATA = { .CTX = { .ctx = _CTX_INIT(core_tsk_loop) } };
 #define IDLE_STK  IDLE_STACK.STK
 #define IDLE_SP  &IDLE_STACK.CTX.ctx
 
+#if OS_TIMER_TASK
+#ifndef OS_TIMER_STACK
+#define OS_TIMER_STACK OS_STACK_SIZE
+#endif
+static  stk_t     TIMER_STK[STK_SIZE(OS_TIMER_STACK)] __STKALIGN __FASTSTK;
+#endif
+
 /* -------------------------------------------------------------------------- */
 
-tmr_t WAIT = { .hdr={ .prev=&WAIT, .next=&WAIT, .id=ID_TIMER }, .delay=INFINITE }; // timers queue
-tsk_t MAIN = { .hdr={ .prev=&IDLE, .next=&IDLE, .id=ID_READY }, .stack=MAIN_TOP, .basic=OS_MAIN_PRIO, .prio=OS_MAIN_PRIO }; // main task
-tsk_t IDLE = { .hdr={ .prev=&MAIN, .next=&MAIN, .id=ID_READY }, .proc=core_tsk_idle, .stack=IDLE_STK, .size=sizeof(IDLE_STK), .sp=IDLE_SP, .owner=&IDLE }; // idle task and tasks queue
+tmr_t WAIT __FASTDATA = { .hdr={ .prev=&WAIT, .next=&WAIT, .id=ID_TIMER }, .delay=INFINITE }; // timers queue
+tsk_t MAIN __FASTDATA = { .hdr={ .prev=&IDLE, .next=&IDLE, .id=ID_READY }, .stack=MAIN_TOP, .basic=OS_MAIN_PRIO, .prio=OS_MAIN_PRIO }; // main task
+tsk_t IDLE __FASTDATA = { .hdr={ .prev=&MAIN, .next=&MAIN, .id=ID_READY }, .proc=core_tsk_idle, .stack=IDLE_STK, .size=sizeof(IDLE_STK), .sp=IDLE_SP, .owner=&IDLE }; // idle task and tasks queue
+
+sys_t System __FASTDATA = { .cur=&MAIN };
+
+#if OS_STACK_PROFILE
+stp_t StackProfile[OS_STACK_PROFILE] = { { .tsk=&MAIN, .live=true }, { .tsk=&IDLE, .proc=core_tsk_idle, .size=sizeof(IDLE_STK) } }; // stack profiler records
+#endif
+
+#if OS_TIMER_TASK
+static
+tsk_t TIMER __FASTDATA = { .proc=core_tmr_service, .stack=TIMER_STK, .size=sizeof(TIMER_STK), .basic=OS_TIMER_TASK, .prio=OS_TIMER_TASK }; // timer service task
+#endif
 
-sys_t System = { .cur=&MAIN };
+/* -------------------------------------------------------------------------- */
+static
+void priv_sys_init( void )
+/* -------------------------------------------------------------------------- */
+{
+	#if OS_STACK_FILL
+	memset(IDLE_STK, 0xFF, sizeof(IDLE_STK) - sizeof(ctx_t));
+	#endif
+	#if OS_STACK_PROFILE
+	StackProfile[1].live = true;
+	#endif
+	port_sys_init();
+	#if OS_TIMER_TASK
+	tsk_start(&TIMER);
+	#endif
+}
 
 /* -------------------------------------------------------------------------- */
 void sys_init( void )
@@ -61,7 +101,7 @@ void sys_init( void )
 {
 	static one_t init = ONE_INIT();
 
-	one_call(&init, port_sys_init);
+	one_call(&init, priv_sys_init);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -94,3 +134,64 @@ void sys_resume( void )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_STACK_PROFILE
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_stk_print( char *buf, size_t size, size_t len, const char *fmt, ... )
+/* -------------------------------------------------------------------------- */
+{
+	va_list args;
+	int result;
+
+	va_start(args, fmt);
+	if (buf == NULL)
+		result = vprintf(fmt, args);
+	else
+	if (len < size)
+		result = vsnprintf(buf + len, size - len, fmt, args);
+	else
+		result = vsnprintf(NULL, 0, fmt, args);
+	va_end(args);
+
+	return result > 0 ? len + (size_t)result : len;
+}
+
+/* -------------------------------------------------------------------------- */
+size_t sys_stackReport( char *buf, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	static const char *kind[] = { "MAIN", "IDLE", "TASK" };
+	stp_t rec;
+	size_t len = 0;
+	unsigned i;
+
+	assert_tsk_context();
+
+	len = priv_stk_print(buf, size, len, "# StateOS stack profile, margin %u%%\n", (unsigned)(OS_STACK_MARGIN));
+	len = priv_stk_print(buf, size, len, "# kind task proc size used recommended\n");
+
+	for (i = 0; i < OS_STACK_PROFILE; i++)
+	{
+		sys_lock();
+		{
+			rec = StackProfile[i];
+		}
+		sys_unlock();
+
+		if (rec.tsk == NULL && rec.proc == NULL)
+			continue;
+
+		len = priv_stk_print(buf, size, len, "%s 0x%08lx 0x%08lx %lu %lu %lu\n", kind[i < 2 ? i : 2],
+		                     (unsigned long)(uintptr_t)rec.tsk, (unsigned long)(uintptr_t)rec.proc,
+		                     (unsigned long)rec.size, (unsigned long)rec.used,
+		                     (unsigned long)STK_OVER(rec.used + rec.used * (OS_STACK_MARGIN) / 100));
+	}
+
+	return len;
+}
+
+#endif//OS_STACK_PROFILE
+
+/* -------------------------------------------------------------------------- */
@@ -90,6 +90,38 @@ void sys_suspend( void );
 
 void sys_resume( void );
 
+/******************************************************************************
+ *
+ * Name              : sys_stackReport
+ *
+ * Description       : write the report of the stack profiler to the buffer
+ *                     the report contains one line for each profiled task:
+ *                     kind (MAIN, IDLE, TASK), task and proc addresses,
+ *                     stack size, the highest recorded stack usage and the recommended stack size (in bytes)
+ *                     the recommended size includes OS_STACK_MARGIN percent of safety margin
+ *
+ * Parameters
+ *   buf             : pointer to the buffer
+ *                     NULL: write the report to the standard output (e.g. over semihosting)
+ *   size            : size of the buffer (in bytes)
+ *
+ * Return            : length of the report (in bytes), not including the terminating null character
+ *                     the report has been truncated if the return value is not less than the size of the buffer
+ *
+ * Note              : use only in thread mode
+ *                     available if OS_STACK_PROFILE > 0
+ *                     size of the stack of MAIN is not known to the kernel (reported as 0)
+ *                     stack usage of MAIN is sampled while switching context
+ *                     stack usage of other tasks is sampled by the idle task and when tasks are restarted or released
+ *                     records of released task objects are merged by the task proc and reported with the task address 0
+ *                     use stateos/tools/stackprofile.py to convert the report into a configuration header
+ *
+ ******************************************************************************/
+
+#if OS_STACK_PROFILE
+size_t sys_stackReport( char *buf, size_t size );
+#endif
+
 #ifdef __cplusplus
 }
 #endif
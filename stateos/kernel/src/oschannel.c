@@ -0,0 +1,468 @@
+/******************************************************************************
+
+    @file    StateOS: oschannel.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "inc/oschannel.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef  __CORTEX_M
+#define priv_chn_barrier() __DMB()
+#else
+#define priv_chn_barrier() __COMPILER_BARRIER()
+#endif
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_chn_init( chn_t *chn, size_t size, void *shm, size_t bufsize, fun_t *bell, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(chn, 0, sizeof(chn_t));
+
+	core_obj_init(&chn->obj, res);
+
+	chn->shm   = shm;
+	chn->size  = size ? MSG_SIZE(size) : 0;
+	chn->limit = size ? ((bufsize - sizeof(chs_t)) / chn->size) * chn->size : bufsize - sizeof(chs_t);
+	chn->bell  = bell;
+}
+
+/* -------------------------------------------------------------------------- */
+void chn_init( chn_t *chn, size_t size, void *shm, size_t bufsize, fun_t *bell )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(chn);
+	assert(shm);
+	assert(bufsize >= CHN_SIZE(1, size));
+
+	sys_lock();
+	{
+		priv_chn_init(chn, size, shm, bufsize, bell, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void chn_reset( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		core_all_wakeup(&chn->obj.queue, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void chn_notify( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		core_all_wakeup(&chn->obj.queue, E_SUCCESS);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_chn_count( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	size_t head = chn->shm->head;
+	size_t tail = chn->shm->tail;
+
+	return tail >= head ? tail - head : chn->limit - head + tail;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_chn_space( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	// one slot (byte) is always kept free to distinguish the full channel from the empty one
+	return chn->limit - priv_chn_count(chn) - (chn->size ? chn->size : 1);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_chn_ring( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	if (chn->bell != NULL)
+		chn->bell();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_chn_get( chn_t *chn, char *data, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	size_t head = chn->shm->head;
+	size_t i;
+
+	for (i = 0; i < size; i++)
+	{
+		data[i] = chn->shm->data[head++];
+		if (head == chn->limit) head = 0;
+	}
+
+	priv_chn_barrier();
+	chn->shm->head = head;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_chn_put( chn_t *chn, const char *data, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	size_t tail = chn->shm->tail;
+	size_t i;
+
+	for (i = 0; i < size; i++)
+	{
+		chn->shm->data[tail++] = data[i];
+		if (tail == chn->limit) tail = 0;
+	}
+
+	priv_chn_barrier();
+	chn->shm->tail = tail;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_chn_take( chn_t *chn, char *data, size_t size, size_t *read )
+/* -------------------------------------------------------------------------- */
+{
+	size_t count = priv_chn_count(chn);
+	msh_t *msh;
+
+	if (chn->size && MSG_SIZE(size) < chn->size)
+		return E_FAILURE;
+
+	if (count == 0)
+		return E_TIMEOUT;
+
+	priv_chn_barrier();
+
+	if (chn->size)
+	{
+		msh = (msh_t *)&chn->shm->data[chn->shm->head];
+		size = msh->size;
+		memcpy(data, msh->data, size);
+		priv_chn_barrier();
+		chn->shm->head = chn->shm->head + chn->size < chn->limit ? chn->shm->head + chn->size : 0;
+	}
+	else
+	{
+		if (size > count)
+			size = count;
+		priv_chn_get(chn, data, size);
+	}
+
+	priv_chn_ring(chn);
+
+	if (read != NULL)
+		*read = size;
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_take( chn_t *chn, void *data, size_t size, size_t *read )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->shm);
+	assert(chn->limit);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_chn_take(chn, data, size, read);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_waitFor( chn_t *chn, void *data, size_t size, size_t *read, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->shm);
+	assert(chn->limit);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_chn_take(chn, data, size, read);
+		if (result == E_TIMEOUT)
+		{
+			result = core_tsk_waitFor(&chn->obj.queue, delay);
+			while (result == E_SUCCESS)
+			{
+				result = priv_chn_take(chn, data, size, read);
+				if (result != E_TIMEOUT)
+					break;
+				result = core_tsk_waitNext(&chn->obj.queue, delay);
+			}
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_waitUntil( chn_t *chn, void *data, size_t size, size_t *read, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->shm);
+	assert(chn->limit);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_chn_take(chn, data, size, read);
+		while (result == E_TIMEOUT)
+		{
+			result = core_tsk_waitUntil(&chn->obj.queue, time);
+			if (result != E_SUCCESS)
+				break;
+			result = priv_chn_take(chn, data, size, read);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_chn_give( chn_t *chn, const char *data, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	msh_t *msh;
+
+	if (chn->size ? MSG_SIZE(size) > chn->size : size >= chn->limit)
+		return E_FAILURE;
+
+	if ((chn->size ? chn->size : size) > priv_chn_space(chn))
+		return E_TIMEOUT;
+
+	priv_chn_barrier();
+
+	if (chn->size)
+	{
+		msh = (msh_t *)&chn->shm->data[chn->shm->tail];
+		msh->size = size;
+		memcpy(msh->data, data, size);
+		priv_chn_barrier();
+		chn->shm->tail = chn->shm->tail + chn->size < chn->limit ? chn->shm->tail + chn->size : 0;
+	}
+	else
+	{
+		priv_chn_put(chn, data, size);
+	}
+
+	priv_chn_ring(chn);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_give( chn_t *chn, const void *data, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->shm);
+	assert(chn->limit);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_chn_give(chn, data, size);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_sendFor( chn_t *chn, const void *data, size_t size, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->shm);
+	assert(chn->limit);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_chn_give(chn, data, size);
+		if (result == E_TIMEOUT)
+		{
+			result = core_tsk_waitFor(&chn->obj.queue, delay);
+			while (result == E_SUCCESS)
+			{
+				result = priv_chn_give(chn, data, size);
+				if (result != E_TIMEOUT)
+					break;
+				result = core_tsk_waitNext(&chn->obj.queue, delay);
+			}
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_sendUntil( chn_t *chn, const void *data, size_t size, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->shm);
+	assert(chn->limit);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_chn_give(chn, data, size);
+		while (result == E_TIMEOUT)
+		{
+			result = core_tsk_waitUntil(&chn->obj.queue, time);
+			if (result != E_SUCCESS)
+				break;
+			result = priv_chn_give(chn, data, size);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+size_t chn_count( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	size_t count;
+
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		count = priv_chn_count(chn);
+		if (chn->size)
+			count /= chn->size;
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+size_t chn_space( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	size_t space;
+
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		space = priv_chn_space(chn);
+		if (chn->size)
+			space /= chn->size;
+	}
+	sys_unlock();
+
+	return space;
+}
+
+/* -------------------------------------------------------------------------- */
+size_t chn_limit( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	size_t limit;
+
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+
+	limit = chn->size ? chn->limit / chn->size - 1 : chn->limit - 1;
+
+	return limit;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -30,6 +30,7 @@
  ******************************************************************************/
 
 #include "inc/osconditionvariable.h"
+#include "inc/ostask.h"
 #include "inc/oscriticalsection.h"
 
 /* -------------------------------------------------------------------------- */
@@ -127,6 +128,7 @@ int cnd_waitFor( cnd_t *cnd, mtx_t *mtx, cnt_t delay )
 	assert(mtx);
 	assert(mtx->obj.res!=RELEASED);
 	assert((mtx->mode & mtxRecursive) == 0);
+	assert(cnd->obj.queue == NULL || cnd->mtx == mtx);
 
 	sys_lock();
 	{
@@ -134,8 +136,13 @@ int cnd_waitFor( cnd_t *cnd, mtx_t *mtx, cnt_t delay )
 		assert(result == E_SUCCESS);
 		if (result == E_SUCCESS)
 		{
+			cnd->mtx = mtx;
 			wait_result = core_tsk_waitFor(&cnd->obj.queue, delay);
-			result = mtx_wait(mtx);
+			if (System.cur->mtx.tree == mtx && mtx->owner != System.cur) // notified task was transferred to the mutex and released by mtx_reset / mtx_destroy
+				wait_result = E_SUCCESS;                                  // the notification has been received, so the mutex is only locked again
+			System.cur->mtx.tree = NULL;
+			if (mtx->owner != System.cur) // mutex has not been passed with the notification
+				result = mtx_wait(mtx);
 			assert(result == E_SUCCESS);
 			if (result == E_SUCCESS)
 				result = wait_result;
@@ -159,6 +166,7 @@ int cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time )
 	assert(mtx);
 	assert(mtx->obj.res!=RELEASED);
 	assert((mtx->mode & mtxRecursive) == 0);
+	assert(cnd->obj.queue == NULL || cnd->mtx == mtx);
 
 	sys_lock();
 	{
@@ -166,8 +174,13 @@ int cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time )
 		assert(result == E_SUCCESS);
 		if (result == E_SUCCESS)
 		{
+			cnd->mtx = mtx;
 			wait_result = core_tsk_waitUntil(&cnd->obj.queue, time);
-			result = mtx_wait(mtx);
+			if (System.cur->mtx.tree == mtx && mtx->owner != System.cur) // notified task was transferred to the mutex and released by mtx_reset / mtx_destroy
+				wait_result = E_SUCCESS;                                  // the notification has been received, so the mutex is only locked again
+			System.cur->mtx.tree = NULL;
+			if (mtx->owner != System.cur) // mutex has not been passed with the notification
+				result = mtx_wait(mtx);
 			assert(result == E_SUCCESS);
 			if (result == E_SUCCESS)
 				result = wait_result;
@@ -178,6 +191,44 @@ int cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time )
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+void priv_cnd_give( cnd_t *cnd, bool all )
+/* -------------------------------------------------------------------------- */
+{
+	mtx_t *mtx = cnd->mtx;
+	tsk_t *tsk;
+
+	// wait morphing: the notified tasks are transferred directly to the mutex
+	// blocked queue; only the task that gets the free mutex is made ready
+	while ((tsk = cnd->obj.queue) != NULL)
+	{
+		if ((mtx->mode & mtxPrioMASK) == mtxPrioProtect && mtx->prio < tsk->prio)
+		{
+			core_one_wakeup(&cnd->obj.queue, E_SUCCESS); // mtx_wait will fail
+		}
+		else
+		if (mtx->owner == NULL)
+		{
+			core_one_wakeup(&cnd->obj.queue, (mtx->mode & mtxInconsistent) ? OWNERDEAD : E_SUCCESS);
+			core_mtx_link(mtx, tsk);
+			mtx->mode &= ~mtxInconsistent;
+		}
+		else
+		{
+			tsk->mtx.tree = mtx;
+			core_tsk_requeue(&mtx->obj.queue, tsk);
+			core_mtx_attach(mtx);
+
+			if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->owner->prio < tsk->prio)
+				core_tsk_prio(mtx->owner, tsk->prio);
+		}
+
+		if (!all)
+			break;
+	}
+}
+
 /* -------------------------------------------------------------------------- */
 void cnd_give( cnd_t *cnd, bool all )
 /* -------------------------------------------------------------------------- */
@@ -187,7 +238,7 @@ void cnd_give( cnd_t *cnd, bool all )
 
 	sys_lock();
 	{
-		while (core_one_wakeup(&cnd->obj.queue, E_SUCCESS) && all);
+		priv_cnd_give(cnd, all);
 	}
 	sys_unlock();
 }
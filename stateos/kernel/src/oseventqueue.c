@@ -44,6 +44,9 @@ void priv_evq_init( evq_t *evq, unsigned *data, size_t bufsize, void *res )
 
 	evq->limit = bufsize / sizeof(unsigned);
 	evq->data  = data;
+#if OS_ATOMICS
+	evq->space = evq->limit;
+#endif
 }
 
 /* -------------------------------------------------------------------------- */
@@ -93,6 +96,12 @@ void priv_evq_reset( evq_t *evq, int event )
 	evq->count = 0;
 	evq->head  = 0;
 	evq->tail  = 0;
+#if OS_ATOMICS
+	evq->space = evq->limit;
+	evq->prod  = 0;
+	evq->cons  = 0;
+	core_async_dispatch(); // the object must not stay on the list of pending requests
+#endif
 
 	core_all_wakeup(&evq->obj.queue, event);
 }
@@ -484,58 +493,43 @@ unsigned evq_limit( evq_t *evq )
 
 /* -------------------------------------------------------------------------- */
 static
-bool priv_evq_emptyAsync( evq_t *evq )
+bool priv_evq_claimAsync( unsigned *count )
 /* -------------------------------------------------------------------------- */
 {
-	return atomic_load(&evq->count) == 0;
-}
+	unsigned cnt = atomic_load(count);
 
-/* -------------------------------------------------------------------------- */
-static
-bool priv_evq_fullAsync( evq_t *evq )
-/* -------------------------------------------------------------------------- */
-{
-	return atomic_load(&evq->count) == evq->limit;
-}
-
-/* -------------------------------------------------------------------------- */
-static
-void priv_evq_decAsync( evq_t *evq )
-/* -------------------------------------------------------------------------- */
-{
-	evq->head = evq->head + 1 < evq->limit ? evq->head + 1 : 0;
-	atomic_fetch_sub(&evq->count, 1);
-}
+	while (cnt > 0)
+		if (atomic_compare_exchange_weak(count, &cnt, cnt - 1))
+			return true;
 
-/* -------------------------------------------------------------------------- */
-static
-void priv_evq_incAsync( evq_t *evq )
-/* -------------------------------------------------------------------------- */
-{
-	evq->tail = evq->tail + 1 < evq->limit ? evq->tail + 1 : 0;
-	atomic_fetch_add(&evq->count, 1);
+	return false;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-unsigned priv_evq_getAsync( evq_t *evq )
+unsigned priv_evq_advanceAsync( evq_t *evq, unsigned *index )
 /* -------------------------------------------------------------------------- */
 {
-	unsigned event = evq->data[evq->head];
+	unsigned pos = atomic_load(index);
+	unsigned nxt;
 
-	priv_evq_decAsync(evq);
+	do nxt = pos + 1 < evq->limit ? pos + 1 : 0;
+	while (!atomic_compare_exchange_weak(index, &pos, nxt));
 
-	return event;
+	return pos;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_evq_putAsync( evq_t *evq, unsigned event )
+void priv_evq_wakeupAsync( evq_t *evq )
 /* -------------------------------------------------------------------------- */
 {
-	evq->data[evq->tail] = event;
-
-	priv_evq_incAsync(evq);
+	// unmasked interrupt handlers cannot touch the kernel queues, so they leave it to the kernel
+	if (port_isr_context())
+		core_async_notify(&evq->ntf, &evq->obj);
+	else
+	if (evq->obj.queue != NULL)
+		core_all_wakeup(&evq->obj.queue, E_SUCCESS);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -544,11 +538,22 @@ int priv_evq_takeAsync( evq_t *evq, unsigned *event )
 /* -------------------------------------------------------------------------- */
 {
 	unsigned evt;
+	unsigned num;
 
-	if (priv_evq_emptyAsync(evq))
+	if (!priv_evq_claimAsync(&evq->count))
 		return E_TIMEOUT;
 
-	evt = priv_evq_getAsync(evq);
+	core_async_enter(&evq->cons);
+	evt = evq->data[priv_evq_advanceAsync(evq, &evq->head)];
+	num = core_async_leave(&evq->cons);
+
+	// the space is released when there is no active consumer
+	if (num > 0)
+	{
+		atomic_fetch_add(&evq->space, num);
+		priv_evq_wakeupAsync(evq);
+	}
+
 	if (event != NULL)
 		*event = evt;
 
@@ -579,12 +584,26 @@ int evq_takeAsync( evq_t *evq, unsigned *event )
 int evq_waitAsync( evq_t *evq, unsigned *event )
 /* -------------------------------------------------------------------------- */
 {
+	int result;
+
 	assert_tsk_context();
+	assert(evq);
+	assert(evq->obj.res!=RELEASED);
+	assert(evq->data);
+	assert(evq->limit);
 
-	while (evq_takeAsync(evq, event) != E_SUCCESS)
-		tsk_yield();
+	sys_lock();
+	{
+		while (result = priv_evq_takeAsync(evq, event), result == E_TIMEOUT)
+		{
+			result = core_tsk_waitFor(&evq->obj.queue, INFINITE);
+			if (result != E_SUCCESS)
+				break;
+		}
+	}
+	sys_unlock();
 
-	return E_SUCCESS;
+	return result;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -592,10 +611,21 @@ static
 int priv_evq_giveAsync( evq_t *evq, unsigned event )
 /* -------------------------------------------------------------------------- */
 {
-	if (priv_evq_fullAsync(evq))
+	unsigned num;
+
+	if (!priv_evq_claimAsync(&evq->space))
 		return E_TIMEOUT;
 
-	priv_evq_putAsync(evq, event);
+	core_async_enter(&evq->prod);
+	evq->data[priv_evq_advanceAsync(evq, &evq->tail)] = event;
+	num = core_async_leave(&evq->prod);
+
+	// the data is published when there is no active producer
+	if (num > 0)
+	{
+		atomic_fetch_add(&evq->count, num);
+		priv_evq_wakeupAsync(evq);
+	}
 
 	return E_SUCCESS;
 }
@@ -624,12 +654,26 @@ int evq_giveAsync( evq_t *evq, unsigned event )
 int evq_sendAsync( evq_t *evq, unsigned event )
 /* -------------------------------------------------------------------------- */
 {
+	int result;
+
 	assert_tsk_context();
+	assert(evq);
+	assert(evq->obj.res!=RELEASED);
+	assert(evq->data);
+	assert(evq->limit);
 
-	while (evq_giveAsync(evq, event) != E_SUCCESS)
-		tsk_yield();
+	sys_lock();
+	{
+		while (result = priv_evq_giveAsync(evq, event), result == E_TIMEOUT)
+		{
+			result = core_tsk_waitFor(&evq->obj.queue, INFINITE);
+			if (result != E_SUCCESS)
+				break;
+		}
+	}
+	sys_unlock();
 
-	return E_SUCCESS;
+	return result;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -45,6 +45,9 @@ void priv_box_init( box_t *box, size_t size, void *data, size_t bufsize, void *r
 	box->data  = data;
 	box->size  = size;
 	box->limit = (bufsize / size) * size;
+#if OS_ATOMICS
+	box->space = box->limit;
+#endif
 }
 
 /* -------------------------------------------------------------------------- */
@@ -96,6 +99,12 @@ void priv_box_reset( box_t *box, int event )
 	box->count = 0;
 	box->head  = 0;
 	box->tail  = 0;
+#if OS_ATOMICS
+	box->space = box->limit;
+	box->prod  = 0;
+	box->cons  = 0;
+	core_async_dispatch(); // the object must not stay on the list of pending requests
+#endif
 
 	core_all_wakeup(&box->obj.queue, event);
 }
@@ -482,54 +491,43 @@ unsigned box_limit( box_t *box )
 
 /* -------------------------------------------------------------------------- */
 static
-bool priv_box_emptyAsync( box_t *box )
+bool priv_box_claimAsync( box_t *box, size_t *count )
 /* -------------------------------------------------------------------------- */
 {
-	return atomic_load(&box->count) == 0;
-}
+	size_t cnt = atomic_load(count);
 
-/* -------------------------------------------------------------------------- */
-static
-bool priv_box_fullAsync( box_t *box )
-/* -------------------------------------------------------------------------- */
-{
-	return atomic_load(&box->count) == box->limit;
-}
+	while (cnt >= box->size)
+		if (atomic_compare_exchange_weak(count, &cnt, cnt - box->size))
+			return true;
 
-/* -------------------------------------------------------------------------- */
-static
-void priv_box_decAsync( box_t *box )
-/* -------------------------------------------------------------------------- */
-{
-	box->head = box->head + box->size < box->limit ? box->head + box->size : 0;
-	atomic_fetch_sub(&box->count, box->size);
+	return false;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_box_incAsync( box_t *box )
+size_t priv_box_advanceAsync( box_t *box, size_t *index )
 /* -------------------------------------------------------------------------- */
 {
-	box->tail = box->tail + box->size < box->limit ? box->tail + box->size : 0;
-	atomic_fetch_add(&box->count, box->size);
-}
+	size_t pos = atomic_load(index);
+	size_t nxt;
 
-/* -------------------------------------------------------------------------- */
-static
-void priv_box_getAsync( box_t *box, char *data )
-/* -------------------------------------------------------------------------- */
-{
-	memcpy(data, &box->data[box->head], box->size);
-	priv_box_decAsync(box);
+	do nxt = pos + box->size < box->limit ? pos + box->size : 0;
+	while (!atomic_compare_exchange_weak(index, &pos, nxt));
+
+	return pos;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_box_putAsync( box_t *box, const char *data )
+void priv_box_wakeupAsync( box_t *box )
 /* -------------------------------------------------------------------------- */
 {
-	memcpy(&box->data[box->tail], data, box->size);
-	priv_box_incAsync(box);
+	// unmasked interrupt handlers cannot touch the kernel queues, so they leave it to the kernel
+	if (port_isr_context())
+		core_async_notify(&box->ntf, &box->obj);
+	else
+	if (box->obj.queue != NULL)
+		core_all_wakeup(&box->obj.queue, E_SUCCESS);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -537,10 +535,21 @@ static
 int priv_box_takeAsync( box_t *box, void *data )
 /* -------------------------------------------------------------------------- */
 {
-	if (priv_box_emptyAsync(box))
+	unsigned num;
+
+	if (!priv_box_claimAsync(box, &box->count))
 		return E_TIMEOUT;
 
-	priv_box_getAsync(box, data);
+	core_async_enter(&box->cons);
+	memcpy(data, &box->data[priv_box_advanceAsync(box, &box->head)], box->size);
+	num = core_async_leave(&box->cons);
+
+	// the space is released when there is no active consumer
+	if (num > 0)
+	{
+		atomic_fetch_add(&box->space, num * box->size);
+		priv_box_wakeupAsync(box);
+	}
 
 	return E_SUCCESS;
 }
@@ -570,12 +579,27 @@ int box_takeAsync( box_t *box, void *data )
 int box_waitAsync( box_t *box, void *data )
 /* -------------------------------------------------------------------------- */
 {
+	int result;
+
 	assert_tsk_context();
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+	assert(data);
 
-	while (box_takeAsync(box, data) != E_SUCCESS)
-		tsk_yield();
+	sys_lock();
+	{
+		while (result = priv_box_takeAsync(box, data), result == E_TIMEOUT)
+		{
+			result = core_tsk_waitFor(&box->obj.queue, INFINITE);
+			if (result != E_SUCCESS)
+				break;
+		}
+	}
+	sys_unlock();
 
-	return E_SUCCESS;
+	return result;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -583,10 +607,21 @@ static
 int priv_box_giveAsync( box_t *box, const void *data )
 /* -------------------------------------------------------------------------- */
 {
-	if (priv_box_fullAsync(box))
+	unsigned num;
+
+	if (!priv_box_claimAsync(box, &box->space))
 		return E_TIMEOUT;
 
-	priv_box_putAsync(box, data);
+	core_async_enter(&box->prod);
+	memcpy(&box->data[priv_box_advanceAsync(box, &box->tail)], data, box->size);
+	num = core_async_leave(&box->prod);
+
+	// the data is published when there is no active producer
+	if (num > 0)
+	{
+		atomic_fetch_add(&box->count, num * box->size);
+		priv_box_wakeupAsync(box);
+	}
 
 	return E_SUCCESS;
 }
@@ -616,12 +651,27 @@ int box_giveAsync( box_t *box, const void *data )
 int box_sendAsync( box_t *box, const void *data )
 /* -------------------------------------------------------------------------- */
 {
+	int result;
+
 	assert_tsk_context();
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+	assert(data);
 
-	while (box_giveAsync(box, data) != E_SUCCESS)
-		tsk_yield();
+	sys_lock();
+	{
+		while (result = priv_box_giveAsync(box, data), result == E_TIMEOUT)
+		{
+			result = core_tsk_waitFor(&box->obj.queue, INFINITE);
+			if (result != E_SUCCESS)
+				break;
+		}
+	}
+	sys_unlock();
 
-	return E_SUCCESS;
+	return result;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -44,7 +44,11 @@ void priv_msg_init( msg_t *msg, size_t size, void *data, size_t bufsize, void *r
 
 	msg->data  = data;
 	msg->size  = MSG_SIZE(size);
+#if OS_MSG_PACKED
+	msg->limit = bufsize < msg->size ? 0 : bufsize;
+#else
 	msg->limit = (bufsize / msg->size) * msg->size;
+#endif
 }
 
 /* -------------------------------------------------------------------------- */
@@ -131,6 +135,77 @@ void msg_destroy( msg_t *msg )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_MSG_PACKED
+
+#define MSG_WRAP ((size_t)0 - 1) // marker of the unused end of the data buffer
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_msg_len( msg_t *msg, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	(void) msg;
+
+	return MSG_SIZE(size);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_msg_headGap( msg_t *msg )
+/* -------------------------------------------------------------------------- */
+{
+	size_t gap = msg->limit - msg->head;
+
+	if (gap >= sizeof(msh_t) && ((msh_t *)&msg->data[msg->head])->size != MSG_WRAP)
+		gap = 0;
+
+	return gap;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_msg_tailGap( msg_t *msg, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	size_t gap = msg->limit - msg->tail;
+
+	if (gap >= MSG_SIZE(size))
+		gap = 0;
+
+	return gap;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_msg_wrap( msg_t *msg, size_t gap )
+/* -------------------------------------------------------------------------- */
+{
+	if (gap >= sizeof(msh_t))
+		((msh_t *)&msg->data[msg->tail])->size = MSG_WRAP;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#else
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_msg_len( msg_t *msg, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	(void) size;
+
+	return msg->size;
+}
+
+#define priv_msg_headGap(msg)       0U
+#define priv_msg_tailGap(msg, size) 0U
+#define priv_msg_wrap(msg, gap)
+
+#endif//OS_MSG_PACKED
+
 /* -------------------------------------------------------------------------- */
 static
 bool priv_msg_empty( msg_t *msg )
@@ -141,28 +216,36 @@ bool priv_msg_empty( msg_t *msg )
 
 /* -------------------------------------------------------------------------- */
 static
-bool priv_msg_full( msg_t *msg )
+bool priv_msg_fits( msg_t *msg, size_t size )
 /* -------------------------------------------------------------------------- */
 {
-	return msg->count == msg->limit;
+	return msg->count + priv_msg_tailGap(msg, size) + priv_msg_len(msg, size) <= msg->limit;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_msg_dec( msg_t *msg )
+void priv_msg_dec( msg_t *msg, size_t gap, size_t len )
 /* -------------------------------------------------------------------------- */
 {
-	msg->head = msg->head + msg->size < msg->limit ? msg->head + msg->size : 0;
-	msg->count -= msg->size;
+	size_t head = gap ? 0 : msg->head;
+
+	msg->head = head + len < msg->limit ? head + len : 0;
+	msg->count -= gap + len;
+#if OS_MSG_PACKED
+	if (msg->count == 0)
+		msg->head = msg->tail = 0;
+#endif
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_msg_inc( msg_t *msg )
+void priv_msg_inc( msg_t *msg, size_t gap, size_t len )
 /* -------------------------------------------------------------------------- */
 {
-	msg->tail = msg->tail + msg->size < msg->limit ? msg->tail + msg->size : 0;
-	msg->count += msg->size;
+	size_t tail = gap ? 0 : msg->tail;
+
+	msg->tail = tail + len < msg->limit ? tail + len : 0;
+	msg->count += gap + len;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -172,39 +255,64 @@ size_t priv_msg_get( msg_t *msg, char *data )
 {
 	size_t size;
 
-	msh_t *msh = (msh_t *)&msg->data[msg->head];
+	size_t gap = priv_msg_headGap(msg);
+	msh_t *msh = (msh_t *)&msg->data[gap ? 0 : msg->head];
 
 	size = msh->size;
 	memcpy(data, msh->data, size);
 
-	priv_msg_dec(msg);
+	priv_msg_dec(msg, gap, priv_msg_len(msg, size));
 
 	return size;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+void priv_msg_skip( msg_t *msg )
+/* -------------------------------------------------------------------------- */
+{
+	size_t gap = priv_msg_headGap(msg);
+	msh_t *msh = (msh_t *)&msg->data[gap ? 0 : msg->head];
+
+	priv_msg_dec(msg, gap, priv_msg_len(msg, msh->size));
+}
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_msg_put( msg_t *msg, const char *data, size_t size )
 /* -------------------------------------------------------------------------- */
 {
-	msh_t *msh = (msh_t *)&msg->data[msg->tail];
+	size_t gap = priv_msg_tailGap(msg, size);
+	msh_t *msh = (msh_t *)&msg->data[gap ? 0 : msg->tail];
 
+	priv_msg_wrap(msg, gap);
 	msh->size = size;
 	memcpy(msh->data, data, size);
 
-	priv_msg_inc(msg);
+	priv_msg_inc(msg, gap, priv_msg_len(msg, size));
 }
 
 /* -------------------------------------------------------------------------- */
 static
-size_t priv_msg_getUpdate( msg_t *msg, char *data )
+void priv_msg_putWaiting( msg_t *msg )
 /* -------------------------------------------------------------------------- */
 {
 	tsk_t *tsk;
 
+	while (msg->obj.queue != NULL && priv_msg_fits(msg, msg->obj.queue->tmp.msg.size))
+	{
+		tsk = core_one_wakeup(&msg->obj.queue, E_SUCCESS);
+		priv_msg_put(msg, tsk->tmp.msg.data.out, tsk->tmp.msg.size);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_msg_getUpdate( msg_t *msg, char *data )
+/* -------------------------------------------------------------------------- */
+{
 	size_t size = priv_msg_get(msg, data);
-	tsk = core_one_wakeup(&msg->obj.queue, E_SUCCESS);
-	if (tsk) priv_msg_put(msg, tsk->tmp.msg.data.out, tsk->tmp.msg.size);
+	priv_msg_putWaiting(msg);
 
 	return size;
 }
@@ -214,11 +322,8 @@ static
 void priv_msg_skipUpdate( msg_t *msg )
 /* -------------------------------------------------------------------------- */
 {
-	tsk_t *tsk;
-
-	priv_msg_dec(msg);
-	tsk = core_one_wakeup(&msg->obj.queue, E_SUCCESS);
-	if (tsk) priv_msg_put(msg, tsk->tmp.msg.data.out, tsk->tmp.msg.size);
+	priv_msg_skip(msg);
+	priv_msg_putWaiting(msg);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -343,8 +448,12 @@ int priv_msg_give( msg_t *msg, const char *data, size_t size )
 	if (MSG_SIZE(size) > msg->size)
 		return E_FAILURE;
 
-	if (priv_msg_full(msg))
+	if (!priv_msg_fits(msg, size))
 		return E_TIMEOUT;
+#if OS_MSG_PACKED
+	if (!priv_msg_empty(msg) && msg->obj.queue != NULL) // don't overtake the waiting senders
+		return E_TIMEOUT;
+#endif
 
 	priv_msg_putUpdate(msg, data, size);
 
@@ -439,7 +548,7 @@ int priv_msg_push( msg_t *msg, const void *data, size_t size )
 	if (MSG_SIZE(size) > msg->limit)
 		return E_FAILURE;
 
-	while (priv_msg_full(msg))
+	while (!priv_msg_fits(msg, size))
 		priv_msg_skipUpdate(msg);
 	priv_msg_put(msg, data, size);
 
@@ -479,7 +588,11 @@ size_t msg_count( msg_t *msg )
 
 	sys_lock();
 	{
+#if OS_MSG_PACKED
+		count = msg->count;
+#else
 		count = msg->count / msg->size;
+#endif
 	}
 	sys_unlock();
 
@@ -497,7 +610,11 @@ size_t msg_space( msg_t *msg )
 
 	sys_lock();
 	{
+#if OS_MSG_PACKED
+		space = msg->limit - msg->count;
+#else
 		space = (msg->limit - msg->count) / msg->size;
+#endif
 	}
 	sys_unlock();
 
@@ -515,7 +632,11 @@ size_t msg_limit( msg_t *msg )
 
 	sys_lock();
 	{
+#if OS_MSG_PACKED
+		limit = msg->limit;
+#else
 		limit = msg->limit / msg->size;
+#endif
 	}
 	sys_unlock();
 
@@ -536,28 +657,32 @@ bool priv_msg_emptyAsync( msg_t *msg )
 
 /* -------------------------------------------------------------------------- */
 static
-bool priv_msg_fullAsync( msg_t *msg )
+bool priv_msg_fitsAsync( msg_t *msg, size_t size )
 /* -------------------------------------------------------------------------- */
 {
-	return atomic_load(&msg->count) == msg->limit;
+	return atomic_load(&msg->count) + priv_msg_tailGap(msg, size) + priv_msg_len(msg, size) <= msg->limit;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_msg_decAsync( msg_t *msg )
+void priv_msg_decAsync( msg_t *msg, size_t gap, size_t len )
 /* -------------------------------------------------------------------------- */
 {
-	msg->head = msg->head + msg->size < msg->limit ? msg->head + msg->size : 0;
-	atomic_fetch_sub(&msg->count, msg->size);
+	size_t head = gap ? 0 : msg->head;
+
+	msg->head = head + len < msg->limit ? head + len : 0;
+	atomic_fetch_sub(&msg->count, gap + len);
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_msg_incAsync( msg_t *msg )
+void priv_msg_incAsync( msg_t *msg, size_t gap, size_t len )
 /* -------------------------------------------------------------------------- */
 {
-	msg->tail = msg->tail + msg->size < msg->limit ? msg->tail + msg->size : 0;
-	atomic_fetch_add(&msg->count, msg->size);
+	size_t tail = gap ? 0 : msg->tail;
+
+	msg->tail = tail + len < msg->limit ? tail + len : 0;
+	atomic_fetch_add(&msg->count, gap + len);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -567,12 +692,13 @@ size_t priv_msg_getAsync( msg_t *msg, char *data )
 {
 	size_t size;
 
-	msh_t *msh = (msh_t *)&msg->data[msg->head];
+	size_t gap = priv_msg_headGap(msg);
+	msh_t *msh = (msh_t *)&msg->data[gap ? 0 : msg->head];
 
 	size = msh->size;
 	memcpy(data, msh->data, size);
 
-	priv_msg_decAsync(msg);
+	priv_msg_decAsync(msg, gap, priv_msg_len(msg, size));
 
 	return size;
 }
@@ -582,12 +708,14 @@ static
 void priv_msg_putAsync( msg_t *msg, const char *data, size_t size )
 /* -------------------------------------------------------------------------- */
 {
-	msh_t *msh = (msh_t *)&msg->data[msg->tail];
+	size_t gap = priv_msg_tailGap(msg, size);
+	msh_t *msh = (msh_t *)&msg->data[gap ? 0 : msg->tail];
 
+	priv_msg_wrap(msg, gap);
 	msh->size = size;
 	memcpy(msh->data, data, size);
 
-	priv_msg_incAsync(msg);
+	priv_msg_incAsync(msg, gap, priv_msg_len(msg, size));
 }
 
 /* -------------------------------------------------------------------------- */
@@ -651,7 +779,12 @@ int priv_msg_giveAsync( msg_t *msg, const void *data, size_t size )
 	if (MSG_SIZE(size) > msg->size)
 		return E_FAILURE;
 
-	if (priv_msg_fullAsync(msg))
+#if OS_MSG_PACKED
+	// the consumer leaves the indexes of an empty queue to the producer
+	if (priv_msg_emptyAsync(msg))
+		msg->head = msg->tail = 0;
+#endif
+	if (!priv_msg_fitsAsync(msg, size))
 		return E_TIMEOUT;
 
 	priv_msg_putAsync(msg, data, size);
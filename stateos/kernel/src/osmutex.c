@@ -132,6 +132,62 @@ unsigned mtx_prio( mtx_t *mtx )
 	return prio;
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_MUTEX_FAST
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_mtx_takeFast( mtx_t *mtx )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *cur = System.cur;
+
+	if ((mtx->mode & mtxRobust) || ((mtx->mode & mtxPrioMASK) == mtxPrioProtect && mtx->prio < cur->prio))
+		return false;
+
+	do
+	{
+		if (port_get_excl((void **)&mtx->owner) != NULL)
+		{
+			port_clr_excl();
+			return false;
+		}
+	}
+	while (!port_put_excl((void **)&mtx->owner, cur));
+
+	return true;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_mtx_giveFast( mtx_t *mtx )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *cur = System.cur;
+
+	do
+	{
+		if (port_get_excl((void **)&mtx->owner) != cur || mtx->count > 0 || (mtx->mode & mtxLinked))
+		{
+			port_clr_excl();
+			return false;
+		}
+	}
+	while (!port_put_excl((void **)&mtx->owner, NULL));
+
+	return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#else
+
+#define priv_mtx_takeFast( mtx ) false
+#define priv_mtx_giveFast( mtx ) false
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 static
 int priv_mtx_take( mtx_t *mtx )
@@ -180,6 +236,9 @@ int mtx_take( mtx_t *mtx )
 	assert((mtx->mode &  mtxTypeMASK) != mtxTypeMASK);
 	assert((mtx->mode &  mtxPrioMASK) != mtxPrioMASK);
 
+	if (priv_mtx_takeFast(mtx))
+		return E_SUCCESS;
+
 	sys_lock();
 	{
 		result = priv_mtx_take(mtx);
@@ -202,11 +261,16 @@ int mtx_waitFor( mtx_t *mtx, cnt_t delay )
 	assert((mtx->mode &  mtxTypeMASK) != mtxTypeMASK);
 	assert((mtx->mode &  mtxPrioMASK) != mtxPrioMASK);
 
+	if (priv_mtx_takeFast(mtx))
+		return E_SUCCESS;
+
 	sys_lock();
 	{
 		result = priv_mtx_take(mtx);
 		if (result == E_TIMEOUT)
 		{
+			core_mtx_attach(mtx);
+
 			if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->owner->prio < System.cur->prio)
 				core_tsk_prio(mtx->owner, System.cur->prio);
 
@@ -233,11 +297,16 @@ int mtx_waitUntil( mtx_t *mtx, cnt_t time )
 	assert((mtx->mode &  mtxTypeMASK) != mtxTypeMASK);
 	assert((mtx->mode &  mtxPrioMASK) != mtxPrioMASK);
 
+	if (priv_mtx_takeFast(mtx))
+		return E_SUCCESS;
+
 	sys_lock();
 	{
 		result = priv_mtx_take(mtx);
 		if (result == E_TIMEOUT)
 		{
+			core_mtx_attach(mtx);
+
 			if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->owner->prio < System.cur->prio)
 				core_tsk_prio(mtx->owner, System.cur->prio);
 
@@ -284,6 +353,9 @@ int mtx_give( mtx_t *mtx )
 	assert((mtx->mode &  mtxTypeMASK) != mtxTypeMASK);
 	assert((mtx->mode &  mtxPrioMASK) != mtxPrioMASK);
 
+	if (priv_mtx_giveFast(mtx))
+		return E_SUCCESS;
+
 	sys_lock();
 	{
 		result = priv_mtx_give(mtx);
@@ -41,6 +41,8 @@ void priv_rwl_init( rwl_t *rwl, void *res )
 	memset(rwl, 0, sizeof(rwl_t));
 
 	core_obj_init(&rwl->obj, res);
+
+	rwl->mode = rwlDefault;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -76,15 +78,52 @@ rwl_t *rwl_create( void )
 	return rwl;
 }
 
+/* -------------------------------------------------------------------------- */
+void rwl_setMode( rwl_t *rwl, unsigned mode )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+	assert((mode & ~rwlMASK) == 0);
+	assert(mode != rwlMASK);
+
+	sys_lock();
+	{
+		rwl->mode = mode;
+	}
+	sys_unlock();
+}
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_rwl_reset( rwl_t *rwl, int event )
 /* -------------------------------------------------------------------------- */
 {
+	core_all_wakeup(&rwl->upgrd, event);
 	core_all_wakeup(&rwl->obj.queue, event);
 	core_all_wakeup(&rwl->queue, event);
 }
 
+/* -------------------------------------------------------------------------- */
+static
+void priv_rwl_wakeRead( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	// admit the whole batch of waiting readers in one pass
+	rwl->count += core_num_wakeup(&rwl->queue, E_SUCCESS, RDR_LIMIT - rwl->count);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rwl_wakeReadIfFree( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	if (rwl->write == false && rwl->upgrd == NULL)
+		if (rwl->obj.queue == NULL || (rwl->mode & rwlMASK) == rwlPreferRead)
+			priv_rwl_wakeRead(rwl);
+}
+
 /* -------------------------------------------------------------------------- */
 void rwl_reset( rwl_t *rwl )
 /* -------------------------------------------------------------------------- */
@@ -121,9 +160,12 @@ static
 int priv_rwl_takeRead( rwl_t *rwl )
 /* -------------------------------------------------------------------------- */
 {
-	if (rwl->write || rwl->count == RDR_LIMIT )
+	if (rwl->write || rwl->upgrd || rwl->count == RDR_LIMIT)
 		return E_TIMEOUT;
 
+	if (rwl->obj.queue && (rwl->mode & rwlMASK) != rwlPreferRead)
+		return E_TIMEOUT; // writer is waiting
+
 	rwl->count++;
 	return E_SUCCESS;
 }
@@ -194,10 +236,23 @@ static
 void priv_rwl_giveRead( rwl_t *rwl )
 /* -------------------------------------------------------------------------- */
 {
-	if (core_one_wakeup(&rwl->queue, E_SUCCESS) == NULL)
-		if (--rwl->count == 0)
-			if (core_one_wakeup(&rwl->obj.queue, E_SUCCESS) != NULL)
-				rwl->write = true;
+	if (rwl->upgrd == NULL)
+		if (rwl->obj.queue == NULL || (rwl->mode & rwlMASK) == rwlPreferRead)
+			if (core_one_wakeup(&rwl->queue, E_SUCCESS) != NULL)
+				return; // reader lock has been passed to the waiting reader
+
+	if (--rwl->count == 0)
+	{
+		if (core_one_wakeup(&rwl->obj.queue, E_SUCCESS) != NULL)
+			rwl->write = true;
+	}
+	else
+	if (rwl->count == 1 && rwl->upgrd)
+	{
+		core_one_wakeup(&rwl->upgrd, E_SUCCESS);
+		rwl->count = 0;
+		rwl->write = true;
+	}
 }
 
 /* -------------------------------------------------------------------------- */
@@ -222,7 +277,7 @@ static
 int priv_rwl_takeWrite( rwl_t *rwl )
 /* -------------------------------------------------------------------------- */
 {
-	if (rwl->write || rwl->count > 0)
+	if (rwl->write || rwl->upgrd || rwl->count > 0)
 		return E_TIMEOUT;
 
 	rwl->write = true;
@@ -262,7 +317,11 @@ int rwl_waitWriteFor( rwl_t *rwl, cnt_t delay )
 	{
 		result = priv_rwl_takeWrite(rwl);
 		if (result == E_TIMEOUT)
+		{
 			result = core_tsk_waitFor(&rwl->obj.queue, delay);
+			if (result == E_TIMEOUT)
+				priv_rwl_wakeReadIfFree(rwl);
+		}
 	}
 	sys_unlock();
 
@@ -283,7 +342,11 @@ int rwl_waitWriteUntil( rwl_t *rwl, cnt_t time )
 	{
 		result = priv_rwl_takeWrite(rwl);
 		if (result == E_TIMEOUT)
+		{
 			result = core_tsk_waitUntil(&rwl->obj.queue, time);
+			if (result == E_TIMEOUT)
+				priv_rwl_wakeReadIfFree(rwl);
+		}
 	}
 	sys_unlock();
 
@@ -295,12 +358,12 @@ static
 void priv_rwl_giveWrite( rwl_t *rwl )
 /* -------------------------------------------------------------------------- */
 {
-	if (core_one_wakeup(&rwl->obj.queue, E_SUCCESS) == NULL)
-	{
-		rwl->write = false;
-		rwl->count = core_tsk_count(&rwl->queue);
-		core_all_wakeup(&rwl->queue, E_SUCCESS);
-	}
+	if (rwl->queue == NULL || (rwl->mode & rwlMASK) != rwlPhaseFair)
+		if (core_one_wakeup(&rwl->obj.queue, E_SUCCESS) != NULL)
+			return; // writer lock has been passed to the waiting writer
+
+	rwl->write = false;
+	priv_rwl_wakeRead(rwl);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -321,3 +384,65 @@ void rwl_giveWrite( rwl_t *rwl )
 }
 
 /* -------------------------------------------------------------------------- */
+static
+int priv_rwl_upgrade( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	if (rwl->upgrd)
+		return E_FAILURE;
+
+	if (rwl->count > 1)
+		return E_TIMEOUT;
+
+	rwl->count = 0;
+	rwl->write = true;
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+int rwl_upgradeFor( rwl_t *rwl, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+	assert(rwl->write==false);
+	assert(rwl->count>0);
+
+	sys_lock();
+	{
+		result = priv_rwl_upgrade(rwl);
+		if (result == E_TIMEOUT)
+		{
+			result = core_tsk_waitFor(&rwl->upgrd, delay);
+			if (result == E_TIMEOUT)
+				priv_rwl_wakeReadIfFree(rwl);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+void rwl_downgrade( rwl_t *rwl )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rwl);
+	assert(rwl->obj.res!=RELEASED);
+	assert(rwl->write==true);
+	assert(rwl->count==0);
+
+	sys_lock();
+	{
+		rwl->write = false;
+		rwl->count = 1;
+		priv_rwl_wakeReadIfFree(rwl);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
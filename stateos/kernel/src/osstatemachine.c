@@ -34,6 +34,137 @@
 #include "inc/oseventqueue.h"
 #include "inc/oscriticalsection.h"
 
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_hsm_mask( hsm_t *hsm, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	event -= hsmUser;
+
+	if (event >= HSM_LIMIT)
+		return 0;
+
+	return hsm->coalesce & (1U << event);
+}
+
+#if OS_HSM_URGENT
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_hsm_putUrgent( hsm_t *hsm, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	if (hsm->ucount >= OS_HSM_URGENT)
+		return E_TIMEOUT;
+
+	hsm->urgent[(hsm->uhead + hsm->ucount++) % OS_HSM_URGENT] = event;
+
+	return E_SUCCESS;
+}
+
+#endif//OS_HSM_URGENT
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_hsm_takeUrgent( hsm_t *hsm, unsigned *event )
+/* -------------------------------------------------------------------------- */
+{
+#if OS_HSM_URGENT
+	if (hsm->ucount == 0)
+		return E_TIMEOUT;
+
+	*event = hsm->urgent[hsm->uhead];
+	hsm->uhead = (hsm->uhead + 1) % OS_HSM_URGENT;
+	hsm->ucount--;
+
+	return E_SUCCESS;
+#else
+	(void) hsm;
+	(void) event;
+
+	return E_TIMEOUT;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_hsm_recall( hsm_t *hsm )
+/* -------------------------------------------------------------------------- */
+{
+#if OS_HSM_DEFER
+	while (hsm->dcount > 0 && priv_hsm_putUrgent(hsm, hsm->defer[hsm->dhead]) == E_SUCCESS)
+	{
+		hsm->dhead = (hsm->dhead + 1) % OS_HSM_DEFER;
+		hsm->dcount--;
+	}
+#else
+	(void) hsm;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_hsm_flush( hsm_t *hsm )
+/* -------------------------------------------------------------------------- */
+{
+	hsm->evq.count = 0;
+	hsm->evq.head  = 0;
+	hsm->evq.tail  = 0;
+
+	hsm->pending = 0;
+#if OS_HSM_URGENT
+	hsm->ucount  = 0;
+#endif
+#if OS_HSM_DEFER
+	hsm->dcount  = 0;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_hsm_wait( hsm_t *hsm, unsigned *event, bool async )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+#if OS_ATOMICS == 0
+	(void) async;
+#endif
+
+	sys_lock();
+	{
+		for (;;)
+		{
+			result = priv_hsm_takeUrgent(hsm, event);
+			if (result == E_TIMEOUT)
+			#if OS_ATOMICS
+				result = async ? evq_takeAsync(&hsm->evq, event) : evq_take(&hsm->evq, event);
+			#else
+				result = evq_take(&hsm->evq, event);
+			#endif
+			if (result == E_SUCCESS)
+				break;
+
+			System.cur->tmp.evq.event = hsmALL; // no event has been handed over yet
+			// events posted by unmasked interrupt handlers resume the task through core_async_notify
+			result = core_tsk_waitFor(&hsm->evq.obj.queue, INFINITE);
+			if (result != E_SUCCESS)
+				break;
+			if (System.cur->tmp.evq.event != hsmALL)
+			{
+				*event = System.cur->tmp.evq.event; // event handed over by the producer
+				break;
+			}
+		}
+
+		if (result == E_SUCCESS)
+			hsm->pending &= ~priv_hsm_mask(hsm, *event);
+	}
+	sys_unlock();
+
+	return result;
+}
+
 /* -------------------------------------------------------------------------- */
 static
 int priv_getStateLevel( hsm_state_t *state )
@@ -165,6 +296,9 @@ void priv_transition( hsm_t *hsm, hsm_state_t *nextState )
 		priv_callHandler(hsm, hsm->state, hsmEntry);
 	}
 
+	if (hsm->state != NULL)
+		priv_hsm_recall(hsm);
+
 	priv_callAction(hsm, hsm->state, hsmInit);
 }
 
@@ -192,7 +326,7 @@ void priv_eventDispatcher( hsm_t *hsm )
 	for (;;)
 	{
 		unsigned event;
-		int      result = evq_wait(&hsm->evq, &event);
+		int      result = priv_hsm_wait(hsm, &event, false);
 
 		if (result != E_SUCCESS || event == hsmStop)
 			break;
@@ -324,6 +458,20 @@ void hsm_link( hsm_action_t *action )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+void hsm_coalesce( hsm_t *hsm, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	assert(hsm);
+	assert(event >= hsmUser && event - hsmUser < HSM_LIMIT);
+
+	sys_lock();
+	{
+		hsm->coalesce |= 1U << (event - hsmUser);
+	}
+	sys_unlock();
+}
+
 /* -------------------------------------------------------------------------- */
 void hsm_start( hsm_t *hsm, tsk_t *tsk, hsm_state_t *initState )
 /* -------------------------------------------------------------------------- */
@@ -339,9 +487,7 @@ void hsm_start( hsm_t *hsm, tsk_t *tsk, hsm_state_t *initState )
 	{
 		if (hsm->state == NULL)
 		{
-			hsm->evq.count = 0; // reset hsm event queue
-			hsm->evq.head  = 0; //
-			hsm->evq.tail  = 0; //
+			priv_hsm_flush(hsm); // reset hsm event queue and lanes
 			priv_transition(hsm, initState);
 			tsk_startWith(tsk, (fun_a *)priv_eventDispatcher, hsm);
 		}
@@ -356,9 +502,7 @@ void priv_hsm_reset( hsm_t *hsm, int event )
 {
 	hsm->state = NULL;
 
-	hsm->evq.count = 0;
-	hsm->evq.head  = 0;
-	hsm->evq.tail  = 0;
+	priv_hsm_flush(hsm);
 
 	core_all_wakeup(&hsm->evq.obj.queue, event);
 }
@@ -394,46 +538,174 @@ void hsm_destroy( hsm_t *hsm )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+static
+int priv_hsm_give( hsm_t *hsm, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned mask = priv_hsm_mask(hsm, event);
+	int result;
+
+	if (hsm->pending & mask)
+		return E_SUCCESS; // coalesced event is already pending
+
+	result = evq_give(&hsm->evq, event);
+	if (result == E_SUCCESS)
+		hsm->pending |= mask;
+
+	return result;
+}
+
 /* -------------------------------------------------------------------------- */
 int hsm_give( hsm_t *hsm, unsigned event )
 /* -------------------------------------------------------------------------- */
 {
+	int result;
+
 	assert(hsm);
 	assert(event >= hsmUser || event == hsmStop);
 
-	return evq_give(&hsm->evq, event);
+	sys_lock();
+	{
+		result = priv_hsm_give(hsm, event);
+	}
+	sys_unlock();
+
+	return result;
 }
 
 /* -------------------------------------------------------------------------- */
 int hsm_sendFor( hsm_t *hsm, unsigned event, cnt_t delay )
 /* -------------------------------------------------------------------------- */
 {
+	int result;
+
 	assert(hsm);
 	assert(event >= hsmUser || event == hsmStop);
 
-	return evq_sendFor(&hsm->evq, event, delay);
+	sys_lock();
+	{
+		result = priv_hsm_give(hsm, event);
+		if (result == E_TIMEOUT) // the event passed by the blocked sender is not marked as pending
+			result = evq_sendFor(&hsm->evq, event, delay);
+	}
+	sys_unlock();
+
+	return result;
 }
 
 /* -------------------------------------------------------------------------- */
 int hsm_sendUntil( hsm_t *hsm, unsigned event, cnt_t time )
 /* -------------------------------------------------------------------------- */
 {
+	int result;
+
 	assert(hsm);
 	assert(event >= hsmUser || event == hsmStop);
 
-	return evq_sendUntil(&hsm->evq, event, time);
+	sys_lock();
+	{
+		result = priv_hsm_give(hsm, event);
+		if (result == E_TIMEOUT) // the event passed by the blocked sender is not marked as pending
+			result = evq_sendUntil(&hsm->evq, event, time);
+	}
+	sys_unlock();
+
+	return result;
 }
 
 /* -------------------------------------------------------------------------- */
 void hsm_push( hsm_t *hsm, unsigned event )
 /* -------------------------------------------------------------------------- */
 {
+	unsigned mask;
+
+	assert(hsm);
+	assert(event >= hsmUser || event == hsmStop);
+
+	sys_lock();
+	{
+		mask = priv_hsm_mask(hsm, event);
+		if ((hsm->pending & mask) == 0)
+		{
+			if (hsm->evq.count == hsm->evq.limit) // the oldest event will be removed
+				hsm->pending &= ~priv_hsm_mask(hsm, hsm->evq.data[hsm->evq.head]);
+			evq_push(&hsm->evq, event);
+			hsm->pending |= mask;
+		}
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HSM_URGENT
+
+/* -------------------------------------------------------------------------- */
+int hsm_giveUrgent( hsm_t *hsm, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned mask;
+	int result;
+
 	assert(hsm);
 	assert(event >= hsmUser || event == hsmStop);
 
-	evq_push(&hsm->evq, event);
+	sys_lock();
+	{
+		mask = priv_hsm_mask(hsm, event);
+		if (hsm->pending & mask)
+			result = E_SUCCESS; // coalesced event is already pending
+		else
+		{
+			result = priv_hsm_putUrgent(hsm, event);
+			if (result == E_SUCCESS)
+			{
+				hsm->pending |= mask;
+				if (hsm->evq.count == 0) // the dispatcher may be waiting for the event
+					core_one_wakeup(&hsm->evq.obj.queue, E_SUCCESS);
+			}
+		}
+	}
+	sys_unlock();
+
+	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_HSM_URGENT
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HSM_DEFER
+
+/* -------------------------------------------------------------------------- */
+void hsm_defer( hsm_t *hsm, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	assert(hsm);
+	assert(event >= hsmUser);
+
+	sys_lock();
+	{
+		if (hsm->dcount >= OS_HSM_DEFER) // remove the oldest deferred event
+		{
+			hsm->pending &= ~priv_hsm_mask(hsm, hsm->defer[hsm->dhead]);
+			hsm->dhead = (hsm->dhead + 1) % OS_HSM_DEFER;
+			hsm->dcount--;
+		}
+
+		hsm->defer[(hsm->dhead + hsm->dcount++) % OS_HSM_DEFER] = event;
+		hsm->pending |= priv_hsm_mask(hsm, event);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_HSM_DEFER
+
 /* -------------------------------------------------------------------------- */
 hsm_state_t *hsm_getState( hsm_t *hsm )
 /* -------------------------------------------------------------------------- */
@@ -465,7 +737,7 @@ void priv_eventDispatcherAsync( hsm_t *hsm )
 	for (;;)
 	{
 		unsigned event;
-		int      result = evq_waitAsync(&hsm->evq, &event);
+		int      result = priv_hsm_wait(hsm, &event, true);
 
 		if (result != E_SUCCESS || event == hsmStop)
 			break;
@@ -505,9 +777,7 @@ void hsm_startAsync( hsm_t *hsm, tsk_t *tsk, hsm_state_t *initState )
 	{
 		if (hsm->state == NULL)
 		{
-			hsm->evq.count = 0; // reset hsm event queue
-			hsm->evq.head  = 0; //
-			hsm->evq.tail  = 0; //
+			priv_hsm_flush(hsm); // reset hsm event queue and lanes
 			priv_transition(hsm, initState);
 			tsk_startWith(tsk, (fun_a *)priv_eventDispatcherAsync, hsm);
 		}
@@ -57,14 +57,14 @@ static
 tsk_t *priv_wrk_create( unsigned prio, fun_t *proc, void *arg, size_t size, bool detached )
 /* -------------------------------------------------------------------------- */
 {
-	struct tsk_T { tsk_t tsk; stk_t buf[]; } *tmp;
-	tsk_t *tsk = NULL;
+	tsk_t *tsk;
+	stk_t *stack;
 	size_t bufsize;
 
 	bufsize = STK_OVER(size);
-	tmp = malloc(sizeof(struct tsk_T) + bufsize);
-	if (tmp)
-		priv_wrk_init(tsk = &tmp->tsk, prio, proc, arg, tmp->buf, bufsize, tmp, detached);
+	tsk = core_tsk_alloc(&stack, &bufsize);
+	if (tsk)
+		priv_wrk_init(tsk, prio, proc, arg, stack, bufsize, tsk, detached);
 
 	return tsk;
 }
@@ -85,6 +85,23 @@ void wrk_init( tsk_t *tsk, unsigned prio, fun_t *proc, stk_t *stack, size_t size
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+void bas_init( tsk_t *tsk, unsigned prio, fun_t *proc, stk_t *stack, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tsk);
+	assert(stack);
+	assert(size>sizeof(ctx_t));
+
+	sys_lock();
+	{
+		priv_wrk_init(tsk, prio, proc, NULL, stack, size, NULL, false);
+		tsk->shared = true;
+	}
+	sys_unlock();
+}
+
 /* -------------------------------------------------------------------------- */
 void tsk_init( tsk_t *tsk, unsigned prio, fun_t *proc, stk_t *stack, size_t size )
 /* -------------------------------------------------------------------------- */
@@ -159,6 +176,58 @@ tsk_t *tsk_setup( unsigned prio, fun_a *proc, void *arg, size_t size )
 	return tsk;
 }
 
+/* -------------------------------------------------------------------------- */
+int tsk_submit( unsigned prio, fun_a *proc, void *arg, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk;
+
+	assert_tsk_context();
+	assert(proc);
+	assert(size>sizeof(ctx_t));
+
+	sys_lock();
+	{
+		tsk = priv_wrk_create(prio, (fun_t *)proc, arg, size, true);
+		if (tsk)
+		{
+			tsk->start = core_sys_time();
+
+			core_ctx_init(tsk);
+			core_tsk_insert(tsk);
+		}
+	}
+	sys_unlock();
+
+	return tsk ? E_SUCCESS : E_FAILURE;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TASK_POOL
+
+/* -------------------------------------------------------------------------- */
+unsigned tsk_reserve( unsigned count, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned num;
+
+	assert_tsk_context();
+	assert(size>sizeof(ctx_t));
+
+	sys_lock();
+	{
+		num = core_tsk_reserve(count, STK_OVER(size));
+	}
+	sys_unlock();
+
+	return num;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_TASK_POOL
+
 /* -------------------------------------------------------------------------- */
 void tsk_start( tsk_t *tsk )
 /* -------------------------------------------------------------------------- */
@@ -246,7 +315,7 @@ int tsk_detach( tsk_t *tsk )
 		else
 		if (tsk->hdr.id == ID_STOPPED)              // task is already inactive
 		{
-			core_res_free(&tsk->obj);               // release resources
+			core_tsk_free(tsk);                     // release resources
 			result = E_SUCCESS;
 		}
 		else                                        // task is active and can be detached
@@ -285,7 +354,7 @@ int tsk_join( tsk_t *tsk )
 		if (result != E_FAILURE &&                            // task has not been detached
 		    result != E_DELETED &&                            // task has not been deleted
 		    tsk->hdr.id == ID_STOPPED)                        // task is still inactive
-			core_res_free(&tsk->obj);                         // release resources
+			core_tsk_free(tsk);                               // release resources
 	}
 	sys_unlock();
 
@@ -327,6 +396,10 @@ static
 void priv_tsk_stop( tsk_t *tsk )
 /* -------------------------------------------------------------------------- */
 {
+	#if OS_TASK_BUDGET
+	core_bgt_remove(tsk);                // restore basic priority of the throttled task
+	#endif
+
 	if (tsk->guard != 0)                 // blocked task
 	{
 		core_tsk_unlink(tsk, 0);         // remove task from blocked queue; ignored event value
@@ -373,9 +446,17 @@ void tsk_stop( void )
 
 	priv_sig_reset(System.cur);                    // reset signal variables of current task
 //	priv_mtx_remove(tsk);                          // release all owned robust mutexes
+	#if OS_TASK_BUDGET
+	core_bgt_remove(System.cur);                   // restore basic priority of the throttled task
+	#endif
 
 	if (System.cur->owner == System.cur)           // current task is detached
+	{
+		#if OS_TASK_POOL
+		core_tsk_park(System.cur);                 // park the worker, if the pool is not full
+		#endif
 		priv_tsk_destroy();                        // wait for destruction
+	}
 
 	core_tsk_wakeup(System.cur->owner, E_SUCCESS); // notify waiting task
 	core_tsk_remove(System.cur);                   // remove current task from ready queue
@@ -446,7 +527,7 @@ int tsk_destroy( tsk_t *tsk )
 				priv_tsk_stop(tsk);                     // remove task from all queues
 			}
 
-			core_res_free(&tsk->obj);                   // release resources
+			core_tsk_free(tsk);                         // release resources
 			result = E_SUCCESS;
 		}
 	}
@@ -460,6 +541,7 @@ void tsk_yield( void )
 /* -------------------------------------------------------------------------- */
 {
 	assert_tsk_context();
+	assert(!System.cur->shared);
 
 	sys_lock();
 	{
@@ -491,15 +573,207 @@ void tsk_setPrio( unsigned prio )
 /* -------------------------------------------------------------------------- */
 {
 	assert_tsk_context();
+	assert(!System.cur->shared);
+
+	sys_lock();
+	{
+		#if OS_TASK_BUDGET
+		if (System.cur->bgt.budget != 0 && System.cur->bgt.used >= System.cur->bgt.budget)
+			System.cur->bgt.basic = prio; // restored at the start of the next period
+		else
+		#endif
+		{
+			System.cur->basic = prio;
+			core_cur_prio(prio);
+		}
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_EDF_PRIO
+
+/* -------------------------------------------------------------------------- */
+void tsk_setPeriod( cnt_t period, cnt_t deadline )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *cur = System.cur;
+
+	assert_tsk_context();
+	assert(period);
 
 	sys_lock();
 	{
-		System.cur->basic = prio;
-		core_cur_prio(prio);
+		cur->edf.period   = period;
+		cur->edf.deadline = deadline ? deadline : period;
+		cur->edf.release  = core_sys_time();
+		cur->edf.miss     = 0;
+		cur->basic = OS_EDF_PRIO;
+		core_cur_prio(OS_EDF_PRIO);
+		core_cur_deadline();
 	}
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+int tsk_waitPeriod( void )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *cur = System.cur;
+	cnt_t  now;
+	int    result = E_SUCCESS;
+
+	assert_tsk_context();
+	assert(cur->edf.period);
+
+	sys_lock();
+	{
+		now = core_sys_time();
+
+		if ((cnt_t)(now - cur->edf.release) > cur->edf.deadline)
+		{
+			cur->edf.miss++;
+			result = E_FAILURE;
+		}
+
+		cur->start = cur->edf.release;
+		cur->edf.release += cur->edf.period;
+
+		if ((cnt_t)(now - cur->start) < cur->edf.period)
+			core_tsk_waitNext(&WAIT.obj.queue, cur->edf.period); // released by the timers queue
+		else
+		{
+			cur->start = cur->edf.release;                       // the next job is already released
+			core_cur_deadline();
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned tsk_getMisses( tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned miss;
+
+	assert(tsk);
+
+	sys_lock();
+	{
+		miss = tsk->edf.miss;
+	}
+	sys_unlock();
+
+	return miss;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_EDF_PRIO
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_TASK_BUDGET
+
+/* -------------------------------------------------------------------------- */
+void tsk_setBudget( tsk_t *tsk, cnt_t budget, cnt_t period, unsigned prio )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tsk);
+	assert(tsk->obj.res!=RELEASED);
+	assert(budget == 0 || period >= budget);
+	assert(!tsk->shared);
+
+	sys_lock();
+	{
+		core_bgt_remove(tsk);
+		tsk->bgt.budget  = budget;
+		tsk->bgt.period  = period;
+		tsk->bgt.prio    = prio;
+		tsk->bgt.release = core_sys_time();
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned tsk_getOverruns( tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count;
+
+	assert(tsk);
+
+	sys_lock();
+	{
+		count = tsk->bgt.count;
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+void tsk_budgetHook( void (*hook)( tsk_t * ) )
+/* -------------------------------------------------------------------------- */
+{
+	sys_lock();
+	{
+		core_bgt_hook(hook);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_TASK_BUDGET
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_ROBIN
+
+/* -------------------------------------------------------------------------- */
+void tsk_setPolicy( tsk_t *tsk, unsigned policy, cnt_t quantum )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tsk);
+	assert(tsk->obj.res!=RELEASED);
+	assert(policy == tskRR || policy == tskFIFO);
+
+	sys_lock();
+	{
+		tsk->sch.policy  = policy;
+		tsk->sch.quantum = quantum;
+		tsk->slice = 0;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned tsk_getPolicy( tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned policy;
+
+	assert(tsk);
+
+	sys_lock();
+	{
+		policy = tsk->sch.policy;
+	}
+	sys_unlock();
+
+	return policy;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_ROBIN
+
 /* -------------------------------------------------------------------------- */
 unsigned tsk_getPrio( void )
 /* -------------------------------------------------------------------------- */
@@ -98,6 +98,29 @@ tmr_t *tmr_setup( fun_t *proc, void *arg )
 	return tmr;
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_TIMER_TASK
+
+/* -------------------------------------------------------------------------- */
+void tmr_setISR( tmr_t *tmr, bool isr )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tmr);
+	assert(tmr->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		tmr->isr = isr;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_TIMER_TASK
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_tmr_reset( tmr_t *tmr, int event )
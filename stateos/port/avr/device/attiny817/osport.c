@@ -218,7 +218,8 @@ ISR( TCA0_CMP1_vect )
 //	if (TCA0.SINGLE.INTFLAGS & TCA_SINGLE_CMP1_bm)
 	{
 		TCA0.SINGLE.INTFLAGS = TCA_SINGLE_CMP1_bm;
-		core_ctx_switch();
+		port_ctx_reset();
+		core_tsk_slice((OS_FREQUENCY)/(OS_ROBIN));
 	}
 }
 
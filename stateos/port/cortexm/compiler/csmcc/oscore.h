@@ -44,6 +44,10 @@ extern "C" {
 #define OS_HEAP_SIZE          0 /* default system heap: all free memory       */
 #endif
 
+#if     OS_MALLOC_MUTEX
+#error  osconfig.h: OS_MALLOC_MUTEX is supported only by the gnucc port (newlib)!
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #ifndef OS_STACK_SIZE
@@ -230,6 +234,12 @@ void port_clr_lock( void )
 
 #endif
 
+/* -------------------------------------------------------------------------- */
+
+#if     OS_MUTEX_FAST
+#error  osconfig.h: OS_MUTEX_FAST is not supported by this compiler!
+#endif
+
 /* -------------------------------------------------------------------------- */
 // force yield system control to the next process now
 
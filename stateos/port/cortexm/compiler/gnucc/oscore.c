@@ -35,7 +35,7 @@
 
 #if __CORTEX_M < 3
 
-__attribute__((naked))
+__attribute__((naked)) __FASTCODE
 void PendSV_Handler( void )
 {
 	__ASM volatile
@@ -89,7 +89,7 @@ void PendSV_Handler( void )
 
 #if __CORTEX_M >= 3
 
-__attribute__((naked))
+__attribute__((naked)) __FASTCODE
 void PendSV_Handler( void )
 {
 	__ASM volatile
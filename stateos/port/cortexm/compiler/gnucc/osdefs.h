@@ -38,6 +38,23 @@
 #define __CONSTRUCTOR       __attribute__((constructor))
 #endif
 
+/* -------------------------------------------------------------------------- */
+// placement in the fast memory (see the gnucc linker scripts of the startup package)
+
+#if     OS_FAST_MEMORY
+
+#ifndef __FASTCODE
+#define __FASTCODE          __attribute__((section(".fastcode")))  /* code copied to ITCM / CCM / RAM    */
+#endif
+#ifndef __FASTDATA
+#define __FASTDATA          __attribute__((section(".fastdata")))  /* data copied to DTCM / CCM / RAM    */
+#endif
+#ifndef __FASTSTK
+#define __FASTSTK           __attribute__((section(".faststack"))) /* uninitialized stacks in DTCM / CCM */
+#endif
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #endif//__STATEOSDEFS_H
@@ -32,6 +32,7 @@
 #include <sys/lock.h>
 #include "oskernel.h"
 #include "inc/osmutex.h"
+#include "inc/oscriticalsection.h"
 
 /* -------------------------------------------------------------------------- */
 #ifdef _RETARGETABLE_LOCKING
@@ -103,6 +104,76 @@ void __retarget_lock_release_recursive(const _LOCK_T lock)
 #endif
 /* -------------------------------------------------------------------------- */
 
+#if OS_MALLOC_MUTEX
+
+// newlib allocator is serialized by a recursive priority inheritance mutex;
+// interrupts stay enabled during malloc / free, but the allocator cannot be used in the interrupt context
+
+static mtx_t    MTX = _MTX_INIT(mtxPrioInherit|mtxRecursive, 0);
+static unsigned CNT = 0;    // nesting level of the allocator lock
+static void   * GBG = NULL; // list of blocks whose release has been deferred
+
+void __malloc_lock(struct _reent *reent)
+{
+	(void) reent;
+	assert_tsk_context();
+	// the mutex cannot be waited for by the idle task (see port_free);
+	// other tasks can wait for it also with the kernel locked (e.g. in xxx_create), as for any kernel object
+	assert(MTX.owner == System.cur || System.cur != &IDLE);
+	mtx_lock(&MTX);
+	CNT++;
+}
+
+void __malloc_unlock(struct _reent *reent)
+{
+	void *ptr;
+
+	(void) reent;
+	assert_tsk_context();
+	while (CNT == 1U)            // release deferred blocks before leaving the allocator
+	{
+		sys_lock();
+		{
+			ptr = GBG;
+			if (ptr != NULL)
+				GBG = *(void **)ptr;
+		}
+		sys_unlock();
+
+		if (ptr == NULL)
+			break;
+
+		free(ptr);
+	}
+	CNT--;
+	mtx_unlock(&MTX);
+}
+
+// called by the kernel to release resources of deleted objects;
+// it runs inside kernel operations or in the idle task, where the allocator mutex cannot be waited for,
+// so a block is put on the deferred list when the allocator is busy and released by the next task leaving it
+void port_free(void *ptr)
+{
+	sys_lock();
+	{
+		if (mtx_tryLock(&MTX) == E_SUCCESS)
+		{
+			CNT++;
+			free(ptr);
+			CNT--;
+			mtx_unlock(&MTX);
+		}
+		else
+		{
+			*(void **)ptr = GBG;
+			GBG = ptr;
+		}
+	}
+	sys_unlock();
+}
+
+#else
+
 static lck_t    LCK = 0;
 static unsigned CNT = 0;
 
@@ -124,6 +195,8 @@ void __malloc_unlock(struct _reent *reent)
 		port_put_lock(LCK);
 }
 
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 __NO_RETURN void __cxa_pure_virtual(void)
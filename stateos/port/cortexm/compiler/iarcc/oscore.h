@@ -44,6 +44,10 @@ extern "C" {
 #define OS_HEAP_SIZE          0 /* default system heap: all free memory       */
 #endif
 
+#if     OS_MALLOC_MUTEX
+#error  osconfig.h: OS_MALLOC_MUTEX is supported only by the gnucc port (newlib)!
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #ifndef OS_STACK_SIZE
@@ -216,6 +220,42 @@ void port_clr_lock( void )
 
 #endif
 
+/* -------------------------------------------------------------------------- */
+// exclusive access to the pointer used by the mutex fast path
+// the exclusive monitor is cleared on every exception entry and return
+
+#if OS_MUTEX_FAST
+
+#if     __CORTEX_M < 3
+#error  osconfig.h: OS_MUTEX_FAST requires exclusive access instructions (Cortex-M3 or higher)!
+#endif
+
+__STATIC_INLINE
+void * port_get_excl( void **ptr )
+{
+	return (void *) __LDREXW((volatile uint32_t *) ptr);
+}
+
+__STATIC_INLINE
+bool port_put_excl( void **ptr, void *val )
+{
+	bool result;
+
+	__COMPILER_BARRIER();
+	result = __STREXW((uint32_t) val, (volatile uint32_t *) ptr) == 0U;
+	__COMPILER_BARRIER();
+
+	return result;
+}
+
+__STATIC_INLINE
+void port_clr_excl( void )
+{
+	__CLREX();
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 // force yield system control to the next process now
 
@@ -163,6 +163,98 @@ void SysTick_Handler( void )
  End of the handler
 *******************************************************************************/
 
+	#if OS_TICK_SUPPRESS
+
+/******************************************************************************
+ Non-tick-less mode: suppression of the system tick
+ The system timer is reprogrammed to the next timeout (up to the reload limit)
+ The kernel is locked; any enabled interrupt wakes up the core
+*******************************************************************************/
+
+cnt_t port_tck_sleep( cnt_t ticks )
+{
+	uint32_t period  = SysTick->LOAD + 1U;
+	uint32_t limit   = (SysTick_LOAD_RELOAD_Msk + 1U) / period;
+	uint32_t primask = __get_PRIMASK();
+	#if OS_LOCK_LEVEL && (__CORTEX_M >= 3)
+	uint32_t basepri = __get_BASEPRI();
+	#endif
+	uint32_t count;
+	uint32_t reload;
+	uint32_t elapsed = 0U;
+
+	if (ticks > limit)
+		ticks = (cnt_t)limit;
+
+	__disable_irq();
+	#if OS_LOCK_LEVEL && (__CORTEX_M >= 3)
+	__set_BASEPRI(0U);
+	#endif
+
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+	count = SysTick->VAL;
+
+	if (ticks > 1 && (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) == 0U)
+	{
+		// the first tick ends when the current period ends
+		reload = count + ((uint32_t)ticks - 1U) * period - 1U;
+
+		SysTick->LOAD = reload;
+		SysTick->VAL  = 0U;
+		SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+		__DSB();
+		__WFI();
+		__ISB();
+
+		SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+		count = SysTick->VAL;
+
+		if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+		{
+			// the whole time has passed; the pending tick handler counts the last tick
+			count   = reload - count;
+			elapsed = (uint32_t)ticks - 1U + count / period;
+			count   = period - count % period;
+		}
+		else
+		{
+			// the core has been woken up by another interrupt
+			elapsed = (uint32_t)ticks - 1U - count / period;
+			count   = count % period;
+		}
+
+		if (count < 2U)
+		{
+			count += period;
+			elapsed++;
+		}
+
+		// the current period is completed before the normal reload value is restored
+		SysTick->LOAD = count - 1U;
+		SysTick->VAL  = 0U;
+		SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+		SysTick->LOAD = period - 1U;
+	}
+	else
+	{
+		SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+	}
+
+	#if OS_LOCK_LEVEL && (__CORTEX_M >= 3)
+	__set_BASEPRI(basepri);
+	#endif
+	__set_PRIMASK(primask);
+
+	return (cnt_t)elapsed;
+}
+
+/******************************************************************************
+ End of the function
+*******************************************************************************/
+
+	#endif//OS_TICK_SUPPRESS
+
 #else //HW_TIMER_SIZE
 
 /******************************************************************************
@@ -227,7 +319,7 @@ cnt_t port_sys_time( void )
 void SysTick_Handler( void )
 {
 	SysTick->CTRL;
-	core_ctx_switch();
+	core_tsk_slice((OS_FREQUENCY)/(OS_ROBIN));
 }
 
 /******************************************************************************
@@ -44,6 +44,10 @@ extern "C" {
 #define OS_HEAP_SIZE          0 /* default system heap: all free memory       */
 #endif
 
+#if     OS_MALLOC_MUTEX
+#error  osconfig.h: OS_MALLOC_MUTEX is supported only by the gnucc port (newlib)!
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #ifndef OS_STACK_SIZE
@@ -26,6 +26,7 @@ target_sources(stateos
 	${CMAKE_CURRENT_LIST_DIR}/kernel/ossys.c
 	${CMAKE_CURRENT_LIST_DIR}/kernel/src/osclock.c
 	${CMAKE_CURRENT_LIST_DIR}/kernel/src/osbarrier.c
+	${CMAKE_CURRENT_LIST_DIR}/kernel/src/oschannel.c
 	${CMAKE_CURRENT_LIST_DIR}/kernel/src/osconditionvariable.c
 	${CMAKE_CURRENT_LIST_DIR}/kernel/src/osevent.c
 	${CMAKE_CURRENT_LIST_DIR}/kernel/src/oseventqueue.c
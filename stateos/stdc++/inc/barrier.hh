@@ -62,29 +62,38 @@ _GLIBCXX_BEGIN_NAMESPACE_VERSION
 
     explicit
     barrier(ptrdiff_t __count, _CompletionF __completion = _CompletionF())
-    : _M_phase(0), _M_expected(__count), _M_completion(std::move(__completion)), _M_barrier(__count), _M_wait(nullptr)
+    : _M_phase(0), _M_expected(__count), _M_completion(std::move(__completion)), _M_barrier(__count), _M_wait{nullptr, nullptr}, _M_completing(false)
 	{ assert(__count >= 0 && __count <= max()); }
 
     barrier(barrier const&) = delete;
     barrier& operator=(barrier const&) = delete;
 
+    // the completion function and the release of waiting tasks are performed
+    // by the last arriving task with interrupts enabled;
+    // tasks of the next phase wait on the other queue in the meantime
     arrival_token
     arrive(ptrdiff_t __update = 1) noexcept
     {
-      critical_section cs;
-      assert(__update > 0 && __update <= _M_barrier);
-      arrival_token result = _M_phase;
-      if (__update > 0 && _M_barrier > 0)
+      arrival_token result;
       {
+        critical_section cs;
+        assert(__update > 0 && __update <= _M_barrier);
+        result = _M_phase;
+        if (__update <= 0 || _M_barrier <= 0)
+          return result;
         _M_barrier -= __update;
-        if (_M_barrier <= 0)
-        {
-          _M_completion();
-          ++_M_phase;
-          _M_barrier = _M_expected;
-          core_all_wakeup(&_M_wait, E_SUCCESS);
-        }
+        if (_M_barrier > 0)
+          return result;
+        ++_M_phase;
+        _M_barrier = _M_expected;
+        _M_completing = true;
+      }
+      _M_completion();
+      {
+        critical_section cs;
+        _M_completing = false;
       }
+      __release_all(&_M_wait[result & 1]);
       return result;
     }
 
@@ -92,8 +101,8 @@ _GLIBCXX_BEGIN_NAMESPACE_VERSION
     wait(arrival_token __phase) noexcept
     {
       critical_section cs;
-      if (__phase == _M_phase)
-        core_tsk_waitFor(&_M_wait, INFINITE);
+      if (__phase == _M_phase || (__phase + 1 == _M_phase && _M_completing))
+        core_tsk_waitFor(&_M_wait[__phase & 1], INFINITE);
     }
 
     void
@@ -103,9 +112,11 @@ _GLIBCXX_BEGIN_NAMESPACE_VERSION
     void
     arrive_and_drop() noexcept
     {
-      critical_section cs;
-      if (_M_expected > 0)
-        --_M_expected;
+      {
+        critical_section cs;
+        if (_M_expected > 0)
+          --_M_expected;
+      }
       arrive();
     }
 
@@ -114,7 +125,8 @@ _GLIBCXX_BEGIN_NAMESPACE_VERSION
     _CompletionF  _M_completion;
     ptrdiff_t     _M_expected;
     ptrdiff_t     _M_barrier;
-    tsk_t        *_M_wait;
+    tsk_t        *_M_wait[2];   // waiting tasks of the even and odd phases
+    bool          _M_completing; // the completion step of the previous phase is in progress
   };
 
 _GLIBCXX_END_NAMESPACE_VERSION
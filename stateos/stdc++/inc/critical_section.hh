@@ -34,6 +34,10 @@
 
 #include "inc/oscriticalsection.h"
 
+#ifndef OS_RELEASE_BATCH
+#define OS_RELEASE_BATCH 4 // max number of tasks released at once with interrupts masked
+#endif
+
 namespace std
 {
 	struct critical_section
@@ -50,6 +54,19 @@ namespace std
 		private:
 		lck_t lck_;
 	};
+
+	// wake up all tasks from the queue (que) in single-pass batches of OS_RELEASE_BATCH tasks;
+	// interrupts are masked only for the time of each batch
+	inline
+	void __release_all( tsk_t **que ) noexcept
+	{
+		for (;;)
+		{
+			critical_section cs;
+			if (core_num_wakeup(que, E_SUCCESS, OS_RELEASE_BATCH) < OS_RELEASE_BATCH)
+				break;
+		}
+	}
 }		// namespace std
 
 #endif//__STATEOS_CRITICAL_SECTION_HH
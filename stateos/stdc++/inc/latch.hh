@@ -57,20 +57,21 @@ _GLIBCXX_BEGIN_NAMESPACE_VERSION
     latch(const latch&) = delete;
     latch& operator=(const latch&) = delete;
 
+    // waiting tasks are released by the last counting task with interrupts enabled
     void
     count_down(ptrdiff_t __update = 1) noexcept
     {
-      critical_section cs;
-      assert(__update >= 0 && __update <= _M_latch);
-      if (__update > 0 && _M_latch > 0)
       {
+        critical_section cs;
+        assert(__update >= 0 && __update <= _M_latch);
+        if (__update <= 0 || _M_latch <= 0)
+          return;
         _M_latch -= __update;
-        if (_M_latch <= 0)
-        {
-          _M_latch = 0;
-          core_all_wakeup(&_M_wait, E_SUCCESS);
-        }
+        if (_M_latch > 0)
+          return;
+        _M_latch = 0;
       }
+      __release_all(&_M_wait);
     }
 
     bool
@@ -0,0 +1,154 @@
+/******************************************************************************
+
+    @file    StateOS: bench_alloc.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: interrupt latency and throughput benchmark of the allocator lock
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <time.h>
+#include "../port/cortexm/compiler/gnucc/oslibc.c" // the allocator lock of the gnucc port
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// tasks allocate and release blocks of random sizes through the allocator lock, as newlib does;
+// interrupt latency is the longest time with interrupts masked (the kernel locked), in the host time
+
+#define TASKS    4
+#define OPS      200000 /* allocations of each task */
+#define SLOTS    64     /* live blocks of each task */
+
+#define BUCKETS  10000  /* histogram of the masked intervals, 10 ns per bucket */
+
+static long Last, Masked, MaxMasked;
+static unsigned long Hist[BUCKETS + 1];
+static volatile unsigned Done;
+
+/* -------------------------------------------------------------------------- */
+
+static long now( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+// port_irq is called at every change of the lock state, before the change
+
+static void irq( void )
+{
+	long t = now();
+
+	if (port_isr_masked())
+	{
+		Masked += t - Last;
+	}
+	else
+	if (Masked > 0)
+	{
+		Hist[Masked / 10 < BUCKETS ? Masked / 10 : BUCKETS]++;
+		if (MaxMasked < Masked)
+			MaxMasked = Masked;
+		Masked = 0;
+	}
+
+	Last = t;
+}
+
+// the host may preempt the benchmark at any time, so the percentiles are more reliable than the maximum
+
+static double percentile( double p )
+{
+	unsigned long cnt = 0, sum = 0;
+	unsigned i;
+
+	for (i = 0; i <= BUCKETS; i++)
+		cnt += Hist[i];
+	for (i = 0; i < BUCKETS; i++)
+		if ((sum += Hist[i]) >= cnt * p)
+			break;
+
+	return i * 10 / 1000.0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void worker( void )
+{
+	void *slot[SLOTS] = { NULL };
+	unsigned i, n;
+
+	for (i = 0; i < OPS; i++)
+	{
+		n = test_rand() % SLOTS;
+
+		__malloc_lock(NULL);
+		free(slot[n]);
+		slot[n] = malloc(8 + test_rand() % 256);
+		__malloc_unlock(NULL);
+
+		if (i % 16 == 0)
+			tsk_yield();
+	}
+
+	for (n = 0; n < SLOTS; n++)
+		free(slot[n]);
+
+	Done++;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	unsigned i;
+	long start;
+
+	for (i = 0; i < TASKS; i++)
+		tsk_new(1, worker);
+
+	Last = start = now();
+	port_irq = irq;
+	while (Done < TASKS)
+		tsk_sleepFor(1);
+	port_irq = NULL;
+	start = now() - start;
+
+	#if OS_MALLOC_MUTEX
+	printf("allocator serialized by the mutex:\n");
+	#else
+	printf("allocator serialized by the critical section:\n");
+	#endif
+	printf("  throughput        %8.2f Mops/s\n", TASKS * OPS * 1000.0 / start);
+	printf("  interrupt latency %8.2f us (99%%), %.2f us (99.99%%), %.2f us (max)\n",
+	       percentile(0.99), percentile(0.9999), MaxMasked / 1000.0);
+
+	return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
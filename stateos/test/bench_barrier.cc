@@ -0,0 +1,284 @@
+/******************************************************************************
+
+    @file    StateOS: bench_barrier.cc
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host benchmark of the barrier and latch phase latency
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <string.h>
+#include <time.h>
+#include <cstddef>
+#include <utility>
+#include "os.h"
+#include "inc/barrier.hh"
+#include "inc/latch.hh"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// a pipeline stage barrier of 24 tasks with a completion function of about 2 us;
+// the phase latency is the time from the last arrival to the resumption of the last released task,
+// the blackout is the longest time of the phase with the kernel lock set (interrupts masked), measured by
+// the emulated interrupt (port_irq) that is raised on every change of the lock state;
+// locked_barrier is the previous std::barrier, it runs the completion function and wakes up all tasks under the lock
+
+#define TASKS    24
+#define PHASES   2000
+#define WORK     2000    /* ns, duration of the completion function */
+#define BUCKETS  1000    /* histograms of the durations, 100 ns per bucket */
+
+static unsigned long Latency[BUCKETS + 1];
+static unsigned long Blackout[BUCKETS + 1];
+
+static long Start;       // the last arrival of the current phase
+static long Resumed;     // the last resumption in the current phase
+static long Longest;     // the longest masked region of the current phase
+static long Masking;     // the lock was set at this time
+static long Changed;     // the previous change of the lock state
+static bool Masked;      // the lock state seen at the previous change
+
+/* -------------------------------------------------------------------------- */
+
+static long now( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+static void add( unsigned long *hist, long t )
+{
+	hist[t / 100 < BUCKETS ? t / 100 : BUCKETS]++;
+}
+
+// the host may preempt the benchmark at any time, so the percentiles are more reliable than the maximum
+
+static long percentile( unsigned long *hist, double p )
+{
+	unsigned long cnt = 0, sum = 0;
+	unsigned i;
+
+	for (i = 0; i <= BUCKETS; i++)
+		cnt += hist[i];
+	for (i = 0; i < BUCKETS; i++)
+		if ((sum += hist[i]) >= cnt * p)
+			break;
+
+	return i * 100L;
+}
+
+static void report( const char *name )
+{
+	printf("  %-14s latency %6ld ns (50%%), %6ld ns (99%%), blackout %6ld ns (50%%), %6ld ns (99%%)\n", name,
+	        percentile(Latency, 0.5), percentile(Latency, 0.99), percentile(Blackout, 0.5), percentile(Blackout, 0.99));
+}
+
+// the emulated interrupt sees the lock state set by the previous change
+
+static void irq( void )
+{
+	long t = now();
+	bool masked = port_lck != 0U;
+
+	if (masked && !Masked)
+		Masking = Changed;
+	else
+	if (!masked && Masked && Changed - Masking > Longest)
+		Longest = Changed - Masking;
+
+	Masked = masked;
+	Changed = t;
+}
+
+// the host port creates the host context of a task with the lock set on its first run,
+// so the lock is watched only when all the tasks are running
+
+static void watch( bool on )
+{
+	Masked = port_lck != 0U;
+	Changed = now();
+	port_irq = on ? irq : NULL;
+}
+
+// the phase begins with the last arrival and ends with the last resumption
+
+static void begin( void )
+{
+	Longest = 0;
+	Start = now();
+}
+
+static void end( void )
+{
+	add(Latency, Resumed - Start);
+	add(Blackout, Longest);
+}
+
+static void clear( void )
+{
+	memset(Latency, 0, sizeof(Latency));
+	memset(Blackout, 0, sizeof(Blackout));
+}
+
+/* -------------------------------------------------------------------------- */
+
+struct completion
+{
+	void operator()() noexcept
+	{
+		if (port_irq)
+			end();                       // of the previous phase
+		else
+			watch(true);                 // the first phase is complete
+		begin();
+		while (now() - Start < WORK);
+	}
+};
+
+template<typename _CompletionF>
+class locked_barrier
+{
+public:
+	using arrival_token = std::ptrdiff_t;
+
+	explicit locked_barrier( std::ptrdiff_t count, _CompletionF completion = _CompletionF() )
+	: _M_phase(0), _M_completion(std::move(completion)), _M_expected(count), _M_barrier(count), _M_wait(nullptr) {}
+
+	arrival_token arrive() noexcept
+	{
+		std::critical_section cs;
+		arrival_token result = _M_phase;
+		if (--_M_barrier <= 0)
+		{
+			_M_completion();
+			++_M_phase;
+			_M_barrier = _M_expected;
+			core_all_wakeup(&_M_wait, E_SUCCESS);
+		}
+		return result;
+	}
+
+	void wait( arrival_token phase ) noexcept
+	{
+		std::critical_section cs;
+		if (phase == _M_phase)
+			core_tsk_waitFor(&_M_wait, INFINITE);
+	}
+
+	void arrive_and_wait() noexcept { wait(arrive()); }
+
+private:
+	arrival_token  _M_phase;
+	_CompletionF   _M_completion;
+	std::ptrdiff_t _M_expected;
+	std::ptrdiff_t _M_barrier;
+	tsk_t         *_M_wait;
+};
+
+/* -------------------------------------------------------------------------- */
+
+template<typename _Barrier>
+static void stage( void *arg )
+{
+	_Barrier *bar = static_cast<_Barrier *>(arg);
+
+	for (int i = 0; i < PHASES; i++)
+	{
+		bar->arrive_and_wait();
+		Resumed = now();
+	}
+}
+
+template<typename _Barrier>
+static void run( const char *name )
+{
+	_Barrier bar(TASKS);
+	tsk_t *tsk[TASKS];
+
+	clear();
+	for (int i = 0; i < TASKS; i++)
+		TEST_CHECK((tsk[i] = tsk_setup(1, stage<_Barrier>, &bar, OS_STACK_SIZE)) != NULL);
+	for (int i = 0; i < TASKS; i++)
+		TEST_CHECK(tsk_join(tsk[i]) == E_SUCCESS);
+
+	watch(false);
+
+	report(name);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static std::latch *Latch;
+static int Waiting;
+
+static void waiter( void *arg )
+{
+	(void) arg;
+	Latch->wait();
+	Resumed = now();
+	if (--Waiting == 0)
+		watch(false);                    // the last resumption
+}
+
+static void latch( void )
+{
+	tsk_t *tsk[TASKS];
+
+	clear();
+	for (int i = 0; i < PHASES / 20; i++)
+	{
+		std::latch lat(1);
+		Latch = &lat;
+		Waiting = TASKS;
+		for (int j = 0; j < TASKS; j++)
+			TEST_CHECK((tsk[j] = tsk_setup(1, waiter, NULL, OS_STACK_SIZE)) != NULL);
+		tsk_sleepFor(1);                 // all the tasks wait for the latch
+		watch(true);
+		begin();
+		lat.count_down();
+		for (int j = 0; j < TASKS; j++)
+			TEST_CHECK(tsk_join(tsk[j]) == E_SUCCESS);
+		end();
+	}
+
+	report("latch");
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	printf("%d tasks, OS_RELEASE_BATCH %d:\n", TASKS, OS_RELEASE_BATCH);
+
+	run<std::barrier<completion>>("barrier");
+	run<locked_barrier<completion>>("locked barrier");
+	latch();
+
+	return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
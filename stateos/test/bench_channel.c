@@ -0,0 +1,209 @@
+/******************************************************************************
+
+    @file    StateOS: bench_channel.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: throughput and latency benchmark of the channel between two processes
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#define sig_t host_sig_t // signal.h of the host defines sig_t too
+#include <signal.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#undef  sig_t
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// two kernel instances in two host processes, connected by the channels in the shared mapping
+// and by the eventfd doorbells, as in test_channel.c; the parent sends, the child receives and replies
+// throughput: stream and 8-byte messages from the parent to the child
+// latency: round trip of an 8-byte message (parent -> child -> parent), in the host time
+
+#define STREAM   4096             // limit of the stream channel (in bytes)
+#define CHUNK    1024             // size of a stream transfer (in bytes)
+#define BYTES    (64UL << 20)     // bytes sent through the stream channel
+#define MSGS     64               // limit of the message channels (in messages)
+#define MSGSIZE  8                // size of a message (in bytes)
+#define COUNT    200000           // messages sent in the throughput test
+#define ROUNDS   20000            // round trips in the latency test
+
+typedef struct
+{
+	OS_CHN_BUFFER(stream, STREAM, 0);        // parent -> child
+	OS_CHN_BUFFER(request, MSGS, MSGSIZE);   // parent -> child
+	OS_CHN_BUFFER(reply, MSGS, MSGSIZE);     // child -> parent
+}	shm_t;
+
+static int      Doorbell[2]; // eventfd of each process
+static unsigned Self;        // 0: parent, 1: child
+static chn_t    Stream[1], Request[1], Reply[1];
+static long     Rtt[ROUNDS];
+
+/* -------------------------------------------------------------------------- */
+
+static long now( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+static int compare( const void *a, const void *b )
+{
+	long x = *(const long *)a;
+	long y = *(const long *)b;
+	return (x > y) - (x < y);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void ring( void )
+{
+	uint64_t one = 1;
+	TEST_CHECK(write(Doorbell[!Self], &one, sizeof(one)) == sizeof(one));
+}
+
+static void doorbell( void )
+{
+	struct pollfd pfd = { Doorbell[Self], POLLIN, 0 };
+	uint64_t cnt;
+
+	if (System.cur != &IDLE || port_isr_masked())
+		return;
+
+	if (poll(&pfd, 1, IDLE.hdr.next == &IDLE ? 1 : 0) > 0 && read(Doorbell[Self], &cnt, sizeof(cnt)) == sizeof(cnt))
+	{
+		chn_notifyISR(Stream);
+		chn_notifyISR(Request);
+		chn_notifyISR(Reply);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void parent( void )
+{
+	char data[CHUNK] = { 0 };
+	unsigned long i;
+	long start;
+
+	start = now();
+	for (i = 0; i < BYTES / CHUNK; i++)
+		TEST_CHECK(chn_send(Stream, data, CHUNK) == E_SUCCESS);
+	TEST_CHECK(chn_wait(Reply, data, MSGSIZE, NULL) == E_SUCCESS); // all data received
+	start = now() - start;
+	printf("stream (%u-byte transfers)    %8.2f MB/s\n", CHUNK, BYTES * 1000.0 / start);
+
+	start = now();
+	for (i = 0; i < COUNT; i++)
+		TEST_CHECK(chn_send(Request, data, MSGSIZE) == E_SUCCESS);
+	TEST_CHECK(chn_wait(Reply, data, MSGSIZE, NULL) == E_SUCCESS); // all messages received
+	start = now() - start;
+	printf("messages (%u bytes)             %8.2f Mmsg/s\n", MSGSIZE, COUNT * 1000.0 / start);
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		start = now();
+		TEST_CHECK(chn_send(Request, data, MSGSIZE) == E_SUCCESS);
+		TEST_CHECK(chn_wait(Reply, data, MSGSIZE, NULL) == E_SUCCESS);
+		Rtt[i] = now() - start;
+	}
+	qsort(Rtt, ROUNDS, sizeof(long), compare);
+	printf("round trip latency              %8.2f us (50%%), %.2f us (99%%), %.2f us (max)\n",
+	       Rtt[ROUNDS / 2] / 1000.0, Rtt[ROUNDS * 99 / 100] / 1000.0, Rtt[ROUNDS - 1] / 1000.0);
+}
+
+static void child( void )
+{
+	char data[CHUNK];
+	size_t total = 0, read;
+	unsigned long i;
+
+	while (total < BYTES)
+	{
+		TEST_CHECK(chn_wait(Stream, data, CHUNK, &read) == E_SUCCESS);
+		total += read;
+	}
+	TEST_CHECK(chn_send(Reply, data, MSGSIZE) == E_SUCCESS);
+
+	for (i = 0; i < COUNT; i++)
+		TEST_CHECK(chn_wait(Request, data, MSGSIZE, NULL) == E_SUCCESS);
+	TEST_CHECK(chn_send(Reply, data, MSGSIZE) == E_SUCCESS);
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		TEST_CHECK(chn_wait(Request, data, MSGSIZE, NULL) == E_SUCCESS);
+		TEST_CHECK(chn_send(Reply, data, MSGSIZE) == E_SUCCESS);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	shm_t *shm = mmap(NULL, sizeof(shm_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	int status;
+	pid_t pid;
+
+	TEST_CHECK(shm != MAP_FAILED);
+	Doorbell[0] = eventfd(0, EFD_NONBLOCK);
+	Doorbell[1] = eventfd(0, EFD_NONBLOCK);
+	TEST_CHECK(Doorbell[0] >= 0 && Doorbell[1] >= 0);
+
+	pid = fork();
+	TEST_CHECK(pid >= 0);
+	Self = pid == 0;
+
+	if (Self)
+		TEST_CHECK(prctl(PR_SET_PDEATHSIG, SIGKILL) == 0); // the child does not outlive the benchmark
+
+	chn_init(Stream, 0, shm->stream, sizeof(shm->stream), ring);
+	chn_init(Request, MSGSIZE, shm->request, sizeof(shm->request), ring);
+	chn_init(Reply, MSGSIZE, shm->reply, sizeof(shm->reply), ring);
+	port_irq = doorbell;
+
+	if (Self)
+	{
+		child();
+		return EXIT_SUCCESS;
+	}
+
+	parent();
+	TEST_CHECK(waitpid(pid, &status, 0) == pid);
+	TEST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+
+	return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,185 @@
+/******************************************************************************
+
+    @file    StateOS: bench_cmsis_slab.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host benchmark of the CMSIS-RTOS2 slab pools
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <time.h>
+#include "../cmsis/src/cmsis_os2.c"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// objects of random types are created and deleted at random, never more of a type than its slab holds;
+// the slab build (cmsis_slabs) serves them from the slabs, the heap build (cmsis_heap) from malloc;
+// the host port never releases the host stacks of the task contexts, so the heap calls of the CMSIS layer
+// are counted (malloc is wrapped by the linker) instead of measuring the heap
+
+#define SLOTS    3       /* live objects of each type */
+#define ROUNDS   1000000 /* creations and deletions */
+#define BUCKETS  1000    /* histogram of the durations, 10 ns per bucket */
+
+enum { T_THREAD, T_TIMER, T_FLAGS, T_MUTEX, T_SEMAPHORE, T_COUNT };
+
+static const char *Name[T_COUNT] = { "thread", "timer", "event flags", "mutex", "semaphore" };
+
+static void *Obj[T_COUNT][SLOTS];
+static unsigned long Hist[T_COUNT][BUCKETS + 1];
+
+static bool   Inside;  // the CMSIS layer is called
+static size_t Calls;   // heap calls of the CMSIS layer
+static size_t Bytes;   // bytes requested by the CMSIS layer
+
+void *__real_malloc( size_t size );
+void *__wrap_malloc( size_t size )
+{
+	if (Inside)
+	{
+		Calls++;
+		Bytes += size;
+	}
+	return __real_malloc(size);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static long now( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+static void worker( void *arg )
+{
+	(void) arg;
+	osThreadFlagsWait(1U, osFlagsWaitAny, osWaitForever);
+}
+
+static void callback( void *arg )
+{
+	(void) arg;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void *create( unsigned type )
+{
+	osThreadAttr_t ta = { 0 };
+
+	switch (type)
+	{
+	case T_THREAD:
+		ta.attr_bits  = osThreadJoinable;
+		ta.priority   = osPriorityHigh;
+		ta.stack_size = (1 + test_rand() % 2) * OS_STACK_SIZE; // stack size class 0 or 1
+		return osThreadNew(worker, NULL, &ta);
+	case T_TIMER:     return osTimerNew(callback, osTimerOnce, NULL, NULL);
+	case T_FLAGS:     return osEventFlagsNew(NULL);
+	case T_MUTEX:     return osMutexNew(NULL);
+	case T_SEMAPHORE: return osSemaphoreNew(4, 0, NULL);
+	default:          return NULL;
+	}
+}
+
+static void delete( unsigned type, void *obj )
+{
+	switch (type)
+	{
+	case T_THREAD:    TEST_CHECK(osThreadTerminate(obj) == osOK); break;
+	case T_TIMER:     TEST_CHECK(osTimerDelete(obj) == osOK); break;
+	case T_FLAGS:     TEST_CHECK(osEventFlagsDelete(obj) == osOK); break;
+	case T_MUTEX:     TEST_CHECK(osMutexDelete(obj) == osOK); break;
+	case T_SEMAPHORE: TEST_CHECK(osSemaphoreDelete(obj) == osOK); break;
+	}
+}
+
+// the host may preempt the benchmark at any time, so the percentiles are more reliable than the maximum
+
+static double percentile( unsigned t, double p )
+{
+	unsigned long cnt = 0, sum = 0;
+	unsigned i;
+
+	for (i = 0; i <= BUCKETS; i++)
+		cnt += Hist[t][i];
+	for (i = 0; i < BUCKETS; i++)
+		if ((sum += Hist[t][i]) >= cnt * p)
+			break;
+
+	return i * 10.0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	unsigned i, t;
+	long start, elapsed[T_COUNT] = { 0 };
+	unsigned long ops[T_COUNT] = { 0 };
+	void **obj;
+
+	TEST_CHECK(osKernelInitialize() == osOK);
+	TEST_CHECK(osKernelStart() == osOK);
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		t = test_rand() % T_COUNT;
+		obj = &Obj[t][test_rand() % SLOTS];
+
+		Inside = true;
+		start = now();
+		if (*obj == NULL)
+			TEST_CHECK((*obj = create(t)) != NULL);
+		else
+			delete(t, *obj), *obj = NULL;
+		start = now() - start;
+		Inside = false;
+
+		elapsed[t] += start;
+		ops[t]++;
+		Hist[t][start / 10 < BUCKETS ? start / 10 : BUCKETS]++;
+
+		if (t == T_THREAD)
+			osDelay(1); // the idle task releases the terminated threads
+	}
+
+	#if OS_CMSIS_SLABS
+	printf("objects from the slabs:\n");
+	#else
+	printf("objects from the heap:\n");
+	#endif
+	for (t = 0; t < T_COUNT; t++)
+		printf("  %-12s create / delete %6.0f ns (mean), %6.0f ns (99%%)\n",
+		       Name[t], (double)elapsed[t] / ops[t], percentile(t, 0.99));
+	printf("  heap calls   %zu (%zu bytes)\n", Calls, Bytes);
+
+	return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
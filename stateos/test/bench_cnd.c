@@ -0,0 +1,127 @@
+/******************************************************************************
+
+    @file    StateOS: bench_cnd.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: benchmark of cnd_give(all) with wait morphing against waking all waiters
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <time.h>
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// the producer (main) fills the queue for all consumers and notifies them with the mutex locked;
+// the consumers have a higher priority and the kernel is preemptive (OS_ROBIN), so every task made
+// ready preempts the producer at once;
+// the old behaviour (all waiters woken, each of them locks the mutex again) is emulated by cnd_reset
+
+#define CONSUMERS 16
+#define ROUNDS    20000
+
+static_MTX(mtx, mtxDefault);
+static_CND(cnd);
+
+static unsigned Items;    // items in the queue
+static unsigned Consumed; // items taken from the queue
+
+/* -------------------------------------------------------------------------- */
+
+static long now( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void consumer( void )
+{
+	for (;;)
+	{
+		mtx_lock(mtx);
+		while (Items == 0)
+			cnd_wait(cnd, mtx);
+		Items--;
+		Consumed++;
+		mtx_unlock(mtx);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void run( bool morph )
+{
+	unsigned long cnt;
+	long start;
+	unsigned i;
+
+	Consumed = 0;
+	cnt = port_cnt;
+	start = now();
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		mtx_lock(mtx);
+		Items += CONSUMERS;
+		if (morph)
+			cnd_notifyAll(cnd);
+		else
+			cnd_reset(cnd);
+		mtx_unlock(mtx);
+	}
+
+	start = now() - start;
+	cnt = port_cnt - cnt;
+
+	TEST_CHECK(Consumed == ROUNDS * CONSUMERS);
+	TEST_CHECK(Items == 0);
+
+	printf("%-28s %8.2f switches, %8.2f us per notification\n",
+	       morph ? "wait morphing:" : "wake all waiters:",
+	       (double)cnt / ROUNDS, start / 1000.0 / ROUNDS);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	unsigned i;
+
+	// the consumers block on the condition variable as soon as they are created
+	for (i = 0; i < CONSUMERS; i++)
+		tsk_new(1, consumer);
+
+	printf("producer and %u consumers:\n", CONSUMERS);
+	run(false);
+	run(true);
+
+	return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
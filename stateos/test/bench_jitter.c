@@ -0,0 +1,134 @@
+/******************************************************************************
+
+    @file    StateOS: bench_jitter.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: jitter benchmark of the timer callbacks
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <time.h>
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// 100 periodic timers with periods of 1..10 ticks execute callbacks of a fixed cost;
+// the probe timer (period of 1 tick) stands for a hard real-time callback, it is expired after them
+// latency is measured from the start of the tick interrupt to the callback, in the host time
+
+#define TIMERS   100
+#define TICKS    10000
+#define WORK     1000 /* ns, cost of every callback */
+
+static tmr_t Timer[TIMERS];
+static_TMR(probe, NULL);
+
+static long TickStart; // host time of the last tick interrupt
+
+typedef struct { long sum, max; unsigned long cnt; } lat_t;
+
+static lat_t ProbeLat, TimerLat;
+
+/* -------------------------------------------------------------------------- */
+
+static long now( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+static void measure( lat_t *lat )
+{
+	long t = now() - TickStart;
+	lat->sum += t;
+	lat->cnt += 1;
+	if (lat->max < t)
+		lat->max = t;
+}
+
+static void report( const char *name, lat_t *lat )
+{
+	printf("%-24s mean %7.2f us, max %7.2f us\n", name, lat->sum / 1000.0 / lat->cnt, lat->max / 1000.0);
+}
+
+/* -------------------------------------------------------------------------- */
+// port_irq is called at the start of every tick interrupt and on every change of the lock state,
+// but not inside the interrupt handlers; all ticks are generated by the idle task,
+// so the last call of port_irq in the idle task before a callback is the start of the tick
+
+static void tick( void )
+{
+	if (System.cur == &IDLE)
+		TickStart = now();
+}
+
+static void procTimer( void )
+{
+	long t;
+
+	measure(&TimerLat);
+	for (t = now(); now() - t < WORK; );
+}
+
+static void procProbe( void )
+{
+	measure(&ProbeLat);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	unsigned i;
+
+	for (i = 0; i < TIMERS; i++)
+	{
+		tmr_init(&Timer[i], procTimer);
+		tmr_startPeriodic(&Timer[i], 1 + i % 10);
+	}
+
+	#if OS_TIMER_TASK
+	tmr_setISR(probe, true);
+	#endif
+	tmr_startFrom(probe, 1, 1, procProbe);
+
+	port_irq = tick;
+	tsk_sleepFor(TICKS);
+	port_irq = NULL;
+
+	#if OS_TIMER_TASK
+	printf("callbacks in the timer service task:\n");
+	#else
+	printf("callbacks in the tick interrupt:\n");
+	#endif
+	report("  probe (interrupt)", &ProbeLat);
+	report("  100 periodic timers", &TimerLat);
+
+	return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,125 @@
+/******************************************************************************
+
+    @file    StateOS: bench_msg.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host benchmark of the fixed-slot and packed message queue
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <time.h>
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// the traffic mix: every eighth message has the maximum size of 256 bytes, the others have 8 bytes;
+// a fixed slot takes MSG_SIZE(256) bytes for any message, a packed message takes its own length only
+
+#define MSGSIZE  256
+#define SLOTS    16
+#define ROUNDS   2000000 /* messages given and taken in the throughput test */
+#define BATCH    8       /* messages kept in the queue at a time */
+
+static char Buffer[SLOTS * MSG_SIZE(MSGSIZE)];
+static msg_t msg[1];
+
+/* -------------------------------------------------------------------------- */
+
+static long now( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+static size_t length( unsigned i )
+{
+	return i % 8 == 7 ? MSGSIZE : 8;
+}
+
+/* -------------------------------------------------------------------------- */
+// the queue is filled with the mix until the next message does not fit
+
+static void capacity( void )
+{
+	static char data[MSGSIZE];
+	size_t payload = 0;
+	unsigned n;
+
+	msg_reset(msg);
+	for (n = 0; msg_give(msg, data, length(n)) == E_SUCCESS; n++)
+		payload += length(n);
+
+	printf("  capacity   %8u messages (%zu bytes of data in %zu bytes of buffer, %.1f bytes per message, %.0f%% of the buffer holds data)\n",
+	       n, payload, sizeof(Buffer), (double)sizeof(Buffer) / n, payload * 100.0 / sizeof(Buffer));
+}
+
+/* -------------------------------------------------------------------------- */
+// the batches of messages are given and taken without blocking
+
+static void throughput( void )
+{
+	static char data[MSGSIZE];
+	size_t read, payload = 0;
+	unsigned i, j;
+	long start;
+
+	msg_reset(msg);
+	start = now();
+	for (i = 0; i < ROUNDS; i += BATCH)
+	{
+		for (j = i; j < i + BATCH; j++)
+			TEST_CHECK(msg_give(msg, data, length(j)) == E_SUCCESS);
+		for (j = i; j < i + BATCH; j++)
+		{
+			TEST_CHECK(msg_take(msg, data, sizeof(data), &read) == E_SUCCESS);
+			payload += read;
+		}
+	}
+	start = now() - start;
+
+	printf("  throughput %8.2f Mmsg/s (give + take), %.1f MB/s\n",
+	       ROUNDS * 1000.0 / start, payload * 1000.0 / start);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	msg_init(msg, MSGSIZE, Buffer, sizeof(Buffer));
+
+	#if OS_MSG_PACKED
+	printf("packed messages, 8/256-byte mix (7:1):\n");
+	#else
+	printf("fixed-slot messages, 8/256-byte mix (7:1):\n");
+	#endif
+	capacity();
+	throughput();
+
+	return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
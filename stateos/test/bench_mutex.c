@@ -0,0 +1,87 @@
+/******************************************************************************
+
+    @file    StateOS: bench_mutex.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host benchmark of the mutex lock/unlock cycle
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <time.h>
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// uncontended lock/unlock cycles of a single task;
+// the robust mutex never takes the fast path, so it shows the cost of the kernel lock in both builds
+
+#define CYCLES   10000000
+
+/* -------------------------------------------------------------------------- */
+
+static long now( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+static void cycles( const char *name, unsigned mode )
+{
+	static mtx_t mtx[1];
+	unsigned i;
+	long start;
+
+	mtx_init(mtx, mode, 0);
+
+	start = now();
+	for (i = 0; i < CYCLES; i++)
+	{
+		TEST_CHECK(mtx_lock(mtx) == E_SUCCESS);
+		TEST_CHECK(mtx_unlock(mtx) == E_SUCCESS);
+	}
+	start = now() - start;
+
+	printf("  %-18s %6.2f ns per cycle, %6.2f Mcycles/s\n", name, (double)start / CYCLES, CYCLES * 1000.0 / start);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	#if OS_MUTEX_FAST
+	printf("mutex with the fast path:\n");
+	#else
+	printf("mutex without the fast path:\n");
+	#endif
+	cycles("normal",            mtxNormal);
+	cycles("priority inherit",  mtxNormal + mtxPrioInherit);
+	cycles("robust (slow path)", mtxNormal + mtxRobust);
+
+	return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
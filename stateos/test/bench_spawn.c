@@ -0,0 +1,166 @@
+/******************************************************************************
+
+    @file    StateOS: bench_spawn.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host benchmark of the dynamic task spawn
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <string.h>
+#include <time.h>
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// short-lived tasks are spawned with tsk_setup (joinable, as std::thread) and tsk_submit (detached);
+// the same benchmark is built with malloc only (spawn), the task cache (spawn_cache) and the pool of workers (spawn_pool);
+// only the spawn is measured, the host port creates a new host context for every started task
+// and never releases it, so the heap calls of the kernel are counted (malloc is wrapped by the linker)
+
+#define SPAWNS   10000
+#define BURST    4       /* tasks alive at a time */
+#define BUCKETS  1000    /* histogram of the durations, 10 ns per bucket */
+
+static unsigned long Hist[BUCKETS + 1];
+static volatile unsigned Count;
+
+static bool   Inside;  // the spawn is measured
+static size_t Calls;   // heap calls of the kernel
+
+void *__real_malloc( size_t size );
+void *__wrap_malloc( size_t size )
+{
+	if (Inside)
+		Calls++;
+	return __real_malloc(size);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static long now( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+static void job( void *arg )
+{
+	(void) arg;
+	Count++;
+}
+
+// the host may preempt the benchmark at any time, so the percentiles are more reliable than the maximum
+
+static double percentile( double p )
+{
+	unsigned long cnt = 0, sum = 0;
+	unsigned i;
+
+	for (i = 0; i <= BUCKETS; i++)
+		cnt += Hist[i];
+	for (i = 0; i < BUCKETS; i++)
+		if ((sum += Hist[i]) >= cnt * p)
+			break;
+
+	return i * 10.0;
+}
+
+static void begin( void )
+{
+	memset(Hist, 0, sizeof(Hist));
+	Calls = 0;
+}
+
+static void measure( long start )
+{
+	long t = now() - start;
+	Inside = false;
+	Hist[t / 10 < BUCKETS ? t / 10 : BUCKETS]++;
+}
+
+static void report( const char *name )
+{
+	printf("  %-10s %6.0f ns (50%%), %6.0f ns (99%%), %zu heap calls\n", name, percentile(0.5), percentile(0.99), Calls);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	tsk_t *tsk[BURST];
+	unsigned i, j;
+	long start;
+
+	#if OS_TASK_POOL
+	printf("spawn on parked workers (OS_TASK_POOL %d):\n", OS_TASK_POOL);
+	tsk_reserve(BURST, OS_STACK_SIZE);
+	tsk_reserve(BURST, 2 * OS_STACK_SIZE);
+	#elif OS_TASK_CACHE
+	printf("spawn with the task cache (OS_TASK_CACHE %d):\n", OS_TASK_CACHE);
+	#else
+	printf("spawn with malloc:\n");
+	#endif
+
+	// joinable tasks of two stack size classes
+	begin();
+	for (i = 0; i < SPAWNS; i += BURST)
+	{
+		for (j = 0; j < BURST; j++)
+		{
+			Inside = true;
+			start = now();
+			tsk[j] = tsk_setup(1, job, NULL, j % 2 ? OS_STACK_SIZE : 2 * OS_STACK_SIZE);
+			measure(start);
+			TEST_CHECK(tsk[j] != NULL);
+		}
+		for (j = 0; j < BURST; j++)
+			TEST_CHECK(tsk_join(tsk[j]) == E_SUCCESS);
+	}
+	report("tsk_setup");
+
+	// detached tasks; they are released when they end (or by the idle task without the pool)
+	begin();
+	for (i = 0; i < SPAWNS; i += BURST)
+	{
+		for (j = 0; j < BURST; j++)
+		{
+			Inside = true;
+			start = now();
+			TEST_CHECK(tsk_submit(1, job, NULL, OS_STACK_SIZE) == E_SUCCESS);
+			measure(start);
+		}
+		tsk_sleepFor(1);
+	}
+	report("tsk_submit");
+
+	TEST_CHECK(Count == 2 * SPAWNS);
+
+	return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,232 @@
+/******************************************************************************
+
+    @file    StateOS: stm32f4xx_hal.h
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Mock of the STM32 HAL for the host tests of the StateOS HAL adapters.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STM32F4xx_HAL_H
+#define __STM32F4xx_HAL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------- */
+// only the parts of the HAL used by the adapters are declared; the test defines the functions
+// and drives the callbacks as the interrupt handlers of the real HAL do
+
+#define HAL_UART_MODULE_ENABLED
+#define HAL_SPI_MODULE_ENABLED
+#define HAL_I2C_MODULE_ENABLED
+
+typedef enum
+{
+	HAL_OK       = 0x00U,
+	HAL_ERROR    = 0x01U,
+	HAL_BUSY     = 0x02U,
+	HAL_TIMEOUT  = 0x03U
+
+}	HAL_StatusTypeDef;
+
+#define HAL_MAX_DELAY          0xFFFFFFFFU
+
+/* -------------------------------------------------------------------------- */
+
+// registers of the DMA stream: only the counter of the remaining data items is used
+
+typedef struct
+{
+	volatile uint32_t NDTR;
+
+}	DMA_Stream_TypeDef;
+
+#define DMA_NORMAL             0x00000000U
+#define DMA_CIRCULAR           0x00000100U
+
+typedef struct
+{
+	uint32_t Mode;
+
+}	DMA_InitTypeDef;
+
+typedef struct
+{
+	DMA_Stream_TypeDef * Instance;
+	DMA_InitTypeDef      Init;
+
+}	DMA_HandleTypeDef;
+
+#define __HAL_DMA_GET_COUNTER( __HANDLE__ ) ((__HANDLE__)->Instance->NDTR)
+
+#define SPI_MODE_SLAVE         0x00000000U
+#define SPI_MODE_MASTER        0x00000104U
+
+#define SPI_DIRECTION_2LINES        0x00000000U
+#define SPI_DIRECTION_2LINES_RXONLY 0x00000400U
+#define SPI_DIRECTION_1LINE         0x00008000U
+
+typedef struct
+{
+	uint32_t Mode;
+	uint32_t Direction;
+
+}	SPI_InitTypeDef;
+
+typedef struct __SPI_HandleTypeDef
+{
+	SPI_InitTypeDef     Init;
+	DMA_HandleTypeDef * hdmatx;
+	DMA_HandleTypeDef * hdmarx;
+
+}	SPI_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_SPI_Transmit_IT         ( SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_SPI_Receive_IT          ( SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT  ( SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size );
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA        ( SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_SPI_Receive_DMA         ( SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA ( SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size );
+HAL_StatusTypeDef HAL_SPI_Abort               ( SPI_HandleTypeDef *hspi );
+
+void HAL_SPI_TxCpltCallback   ( SPI_HandleTypeDef *hspi );
+void HAL_SPI_RxCpltCallback   ( SPI_HandleTypeDef *hspi );
+void HAL_SPI_TxRxCpltCallback ( SPI_HandleTypeDef *hspi );
+void HAL_SPI_ErrorCallback    ( SPI_HandleTypeDef *hspi );
+
+/* -------------------------------------------------------------------------- */
+
+#define HAL_UART_STATE_READY   0x00000020U
+#define HAL_UART_STATE_BUSY_TX 0x00000021U
+#define HAL_UART_STATE_BUSY_RX 0x00000022U
+
+typedef uint32_t HAL_UART_StateTypeDef;
+
+typedef struct __UART_HandleTypeDef
+{
+	uint8_t *           pRxBuffPtr;
+	uint16_t            RxXferSize;
+	volatile
+	uint16_t            RxXferCount;
+	DMA_HandleTypeDef * hdmatx;
+	DMA_HandleTypeDef * hdmarx;
+	volatile
+	HAL_UART_StateTypeDef gState;
+	volatile
+	HAL_UART_StateTypeDef RxState;
+#if     USE_HAL_UART_REGISTER_CALLBACKS == 1
+	void (* TxCpltCallback) ( struct __UART_HandleTypeDef *huart );
+	void (* ErrorCallback)  ( struct __UART_HandleTypeDef *huart );
+	void (* RxEventCallback)( struct __UART_HandleTypeDef *huart, uint16_t Pos );
+#endif
+
+}	UART_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_UART_Transmit_IT          ( UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_UART_Transmit_DMA         ( UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_UART_AbortTransmit        ( UART_HandleTypeDef *huart );
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT   ( UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA  ( UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size );
+
+#if     USE_HAL_UART_REGISTER_CALLBACKS == 1
+
+typedef enum
+{
+	HAL_UART_TX_COMPLETE_CB_ID = 0x01U,
+	HAL_UART_ERROR_CB_ID       = 0x04U
+
+}	HAL_UART_CallbackIDTypeDef;
+
+typedef void (*pUART_CallbackTypeDef)       ( UART_HandleTypeDef *huart );
+typedef void (*pUART_RxEventCallbackTypeDef)( UART_HandleTypeDef *huart, uint16_t Pos );
+
+HAL_StatusTypeDef HAL_UART_RegisterCallback       ( UART_HandleTypeDef *huart, HAL_UART_CallbackIDTypeDef CallbackID, pUART_CallbackTypeDef pCallback );
+HAL_StatusTypeDef HAL_UART_RegisterRxEventCallback( UART_HandleTypeDef *huart, pUART_RxEventCallbackTypeDef pCallback );
+
+#else
+
+void HAL_UART_TxCpltCallback    ( UART_HandleTypeDef *huart );
+void HAL_UART_ErrorCallback     ( UART_HandleTypeDef *huart );
+void HAL_UARTEx_RxEventCallback ( UART_HandleTypeDef *huart, uint16_t Size );
+
+#endif//USE_HAL_UART_REGISTER_CALLBACKS
+
+/* -------------------------------------------------------------------------- */
+
+typedef struct __I2C_HandleTypeDef
+{
+	DMA_HandleTypeDef * hdmatx;
+	DMA_HandleTypeDef * hdmarx;
+#if     USE_HAL_I2C_REGISTER_CALLBACKS == 1
+	void (* MasterTxCpltCallback)( struct __I2C_HandleTypeDef *hi2c );
+	void (* MasterRxCpltCallback)( struct __I2C_HandleTypeDef *hi2c );
+	void (* ErrorCallback)       ( struct __I2C_HandleTypeDef *hi2c );
+	void (* AbortCpltCallback)   ( struct __I2C_HandleTypeDef *hi2c );
+#endif
+
+}	I2C_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT  ( I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_I2C_Master_Receive_IT   ( I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA ( I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA  ( I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size );
+HAL_StatusTypeDef HAL_I2C_Master_Abort_IT     ( I2C_HandleTypeDef *hi2c, uint16_t DevAddress );
+
+#if     USE_HAL_I2C_REGISTER_CALLBACKS == 1
+
+typedef enum
+{
+	HAL_I2C_MASTER_TX_COMPLETE_CB_ID = 0x00U,
+	HAL_I2C_MASTER_RX_COMPLETE_CB_ID = 0x01U,
+	HAL_I2C_ERROR_CB_ID              = 0x07U,
+	HAL_I2C_ABORT_CB_ID              = 0x08U
+
+}	HAL_I2C_CallbackIDTypeDef;
+
+typedef void (*pI2C_CallbackTypeDef)( I2C_HandleTypeDef *hi2c );
+
+HAL_StatusTypeDef HAL_I2C_RegisterCallback( I2C_HandleTypeDef *hi2c, HAL_I2C_CallbackIDTypeDef CallbackID, pI2C_CallbackTypeDef pCallback );
+
+#else
+
+void HAL_I2C_MasterTxCpltCallback ( I2C_HandleTypeDef *hi2c );
+void HAL_I2C_MasterRxCpltCallback ( I2C_HandleTypeDef *hi2c );
+void HAL_I2C_ErrorCallback        ( I2C_HandleTypeDef *hi2c );
+void HAL_I2C_AbortCpltCallback    ( I2C_HandleTypeDef *hi2c );
+
+#endif//USE_HAL_I2C_REGISTER_CALLBACKS
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//__STM32F4xx_HAL_H
@@ -0,0 +1,47 @@
+/******************************************************************************
+
+    @file    StateOS: lock.h
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Mock of the newlib lock definitions for the host tests.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_TEST_SYS_LOCK_H
+#define __STATEOS_TEST_SYS_LOCK_H
+
+/* -------------------------------------------------------------------------- */
+// oslibc.c of the gnucc port is built on the host without retargetable locking;
+// the tests call __malloc_lock / __malloc_unlock around the allocator as newlib does
+
+struct _reent;
+
+void __malloc_lock( struct _reent *reent );
+void __malloc_unlock( struct _reent *reent );
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_TEST_SYS_LOCK_H
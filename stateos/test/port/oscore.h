@@ -0,0 +1,219 @@
+/******************************************************************************
+
+    @file    StateOS: oscore.h
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS port file for the host test harness.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOSCORE_H
+#define __STATEOSCORE_H
+
+#include "osbase.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_HEAP_SIZE
+#define OS_HEAP_SIZE          0 /* default system heap: all free memory       */
+#endif
+
+#ifndef OS_MALLOC_MUTEX
+#define OS_MALLOC_MUTEX       0 /* allocator lock of the gnucc port (oslibc.c): 0 - critical section, 1 - mutex */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_STACK_SIZE
+#define OS_STACK_SIZE       256 /* default task stack size in bytes           */
+#endif
+
+#ifndef OS_IDLE_STACK
+#define OS_IDLE_STACK       128 /* idle task stack size in bytes              */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_MAIN_PRIO
+#define OS_MAIN_PRIO          0 /* priority of main process                   */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+typedef uint32_t              lck_t;
+typedef uint64_t              stk_t;
+
+/* -------------------------------------------------------------------------- */
+
+// task context
+// tasks run on host stacks; the context placed on top of the task stack refers to the host context
+typedef struct __ctx ctx_t;
+
+struct __ctx
+{
+	fun_t  * pc;  // entry procedure of a new context
+	void   * uc;  // host context (ucontext_t), NULL for a new context
+};
+
+#define _CTX_INIT( pc ) { pc, NULL }
+
+/* -------------------------------------------------------------------------- */
+// emulated processor state
+
+extern volatile lck_t port_lck; // interrupts are masked
+extern volatile bool  port_isr; // an interrupt handler is running
+extern volatile bool  port_pnd; // context switch is pending
+extern          ctx_t*port_ctx; // context of the running process
+extern          void(*port_irq)(void); // handler of the emulated unmasked interrupt, NULL if disabled
+extern unsigned long  port_cnt; // number of context switches
+
+/* -------------------------------------------------------------------------- */
+// init task context
+
+__STATIC_INLINE
+void port_ctx_init( ctx_t *ctx, fun_t *pc )
+{
+	ctx->pc = pc;
+	ctx->uc = NULL;
+}
+
+/* -------------------------------------------------------------------------- */
+// is procedure inside ISR?
+
+__STATIC_INLINE
+bool port_isr_context( void )
+{
+	return port_isr;
+}
+
+/* -------------------------------------------------------------------------- */
+// are interrupts masked?
+
+__STATIC_INLINE
+bool port_isr_masked( void )
+{
+	return port_lck != 0U;
+}
+
+/* -------------------------------------------------------------------------- */
+// get current stack pointer
+
+__STATIC_INLINE
+void * port_get_sp( void )
+{
+	return port_ctx;
+}
+
+/* -------------------------------------------------------------------------- */
+
+__STATIC_INLINE
+lck_t port_get_lock( void )
+{
+	return port_lck;
+}
+
+// the emulated unmasked interrupt is raised on every change of the lock state
+
+__STATIC_INLINE
+void port_put_lock( lck_t lck )
+{
+	port_irq_handler();
+	port_lck = lck;
+	if (port_pnd && !port_lck && !port_isr)
+		port_ctx_handler();
+}
+
+__STATIC_INLINE
+void port_set_lock( void )
+{
+	port_irq_handler();
+	port_lck = 1U;
+}
+
+__STATIC_INLINE
+void port_clr_lock( void )
+{
+	port_put_lock(0U);
+}
+
+/* -------------------------------------------------------------------------- */
+// exclusive access to the pointer used by the mutex fast path
+// the emulated processor has no interrupts between the load and the store
+
+#if OS_MUTEX_FAST
+
+__STATIC_INLINE
+void * port_get_excl( void **ptr )
+{
+	return *ptr;
+}
+
+__STATIC_INLINE
+bool port_put_excl( void **ptr, void *val )
+{
+	*ptr = val;
+	return true;
+}
+
+__STATIC_INLINE
+void port_clr_excl( void )
+{
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+// force yield system control to the next process now
+
+__STATIC_INLINE
+void port_ctx_switchNow( void )
+{
+	lck_t lck = port_get_lock();
+	port_ctx_switch();
+	port_clr_lock();
+	port_put_lock(lck);
+}
+
+/* -------------------------------------------------------------------------- */
+// release memory of a deleted object; used by the kernel when the allocator is serialized by a mutex
+// the tests of the allocator lock are built with oslibc.c of the gnucc port
+
+#if OS_MALLOC_MUTEX
+
+void port_free( void *ptr );
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//__STATEOSCORE_H
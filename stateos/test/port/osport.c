@@ -0,0 +1,172 @@
+/******************************************************************************
+
+    @file    StateOS: osport.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS port file for the host test harness.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <ucontext.h>
+#include "oskernel.h"
+#include "inc/ostask.h"
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef PORT_STACK_SIZE
+#define PORT_STACK_SIZE (256*1024) /* size of the host stack of every task context */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+SysTick_Type   port_systick;
+
+volatile lck_t port_lck;
+volatile bool  port_isr;
+volatile bool  port_pnd;
+
+static ucontext_t MAIN_UC;
+static ucontext_t DEAD_UC; // context of a process that will never be resumed
+static ctx_t      MAIN_CTX = { NULL, &MAIN_UC };
+
+ctx_t *port_ctx = &MAIN_CTX;
+
+void (*port_irq)( void ) = NULL;
+
+unsigned long port_cnt = 0;
+
+/* -------------------------------------------------------------------------- */
+
+void port_sys_init( void )
+{
+	port_systick.LOAD = (CPU_FREQUENCY)/(OS_FREQUENCY)-1;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void port_ctx_switch( void )
+{
+	port_pnd = true;
+	if (!port_lck && !port_isr)
+		port_ctx_handler();
+}
+
+/* -------------------------------------------------------------------------- */
+// create the host context of a new task context; host stacks are never released
+
+static
+void priv_ctx_create( ctx_t *ctx )
+{
+	ucontext_t *uc = malloc(sizeof(ucontext_t));
+	void *stk = malloc(PORT_STACK_SIZE);
+
+	if (uc == NULL || stk == NULL)
+		abort();
+
+	getcontext(uc);
+	uc->uc_stack.ss_sp   = stk;
+	uc->uc_stack.ss_size = PORT_STACK_SIZE;
+	uc->uc_link          = NULL;
+	makecontext(uc, ctx->pc, 0);
+
+	ctx->uc = uc;
+}
+
+/* -------------------------------------------------------------------------- */
+// emulated PendSV handler
+
+void port_ctx_handler( void )
+{
+	ctx_t *cur = port_ctx;
+	void  *old = cur->uc;
+	ctx_t *nxt;
+
+	port_pnd = false;
+	port_isr = true;
+	nxt = core_tsk_switch(cur);
+	port_isr = false;
+
+	if (nxt->uc == NULL)
+		priv_ctx_create(nxt);
+	else
+	if (nxt == cur)
+		return;
+
+	port_ctx = nxt;
+	port_cnt++;
+	// the context of the current process may have been recreated by the kernel
+	swapcontext(cur->uc == old ? old : &DEAD_UC, nxt->uc);
+}
+
+/* -------------------------------------------------------------------------- */
+// emulated SysTick handler
+
+void port_tck_handler( void )
+{
+	port_irq_handler();
+
+	port_systick.CTRL |= SysTick_CTRL_COUNTFLAG_Msk;
+
+	port_isr = true;
+	core_sys_tick();
+	port_isr = false;
+
+	if (port_pnd && !port_lck)
+		port_ctx_handler();
+}
+
+/* -------------------------------------------------------------------------- */
+// emulated unmasked interrupt; it does not nest and it does not preempt other interrupt handlers
+
+void port_irq_handler( void )
+{
+	if (port_irq == NULL || port_isr)
+		return;
+
+	port_isr = true;
+	port_irq();
+	port_isr = false;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tsk_flip( void *sp )
+{
+	ctx_t *ctx = (ctx_t *)sp - 1;
+
+	#if OS_TASK_EXIT == 0
+	port_ctx_init(ctx, core_tsk_loop);
+	#else
+	port_ctx_init(ctx, core_tsk_exec);
+	#endif
+	priv_ctx_create(ctx);
+
+	port_ctx = ctx;
+	setcontext(ctx->uc);
+	abort();
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,157 @@
+/******************************************************************************
+
+    @file    StateOS: osport.h
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS port definitions for the host test harness.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOSPORT_H
+#define __STATEOSPORT_H
+
+#include <stdint.h>
+#ifndef   NOCONFIG
+#include "osconfig.h"
+#endif
+#include "osdefs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef CPU_FREQUENCY
+#define CPU_FREQUENCY   1000000 /* Hz */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef  ST_FREQUENCY
+#error  ST_FREQUENCY is an internal port definition!
+#else
+#define ST_FREQUENCY    CPU_FREQUENCY /* Hz */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_FREQUENCY
+#define OS_FREQUENCY       1000 /* Hz */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_TIMER_SIZE
+#define OS_TIMER_SIZE        32 /* bit size of system timer counter           */
+#endif
+
+/* -------------------------------------------------------------------------- */
+// the system tick is generated by port_tck_handler; tick-less mode is not supported
+
+#ifdef  HW_TIMER_SIZE
+#error  HW_TIMER_SIZE is an internal os definition!
+#else
+#define HW_TIMER_SIZE         0 /* os does not work in tick-less mode         */
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef OS_ROBIN
+#define OS_ROBIN              0 /* system works in cooperative mode           */
+#endif
+
+#if     OS_ROBIN > OS_FREQUENCY
+#error  osconfig.h: Incorrect OS_ROBIN value!
+#endif
+
+/* -------------------------------------------------------------------------- */
+// emulated SysTick (used by the CMSIS wrappers)
+
+typedef struct { volatile uint32_t CTRL, LOAD, VAL, CALIB; } SysTick_Type;
+
+extern  SysTick_Type        port_systick;
+#define SysTick           (&port_systick)
+#define SysTick_CTRL_COUNTFLAG_Msk (1UL << 16)
+
+/* -------------------------------------------------------------------------- */
+// emulated interrupt handlers
+// port_tck_handler generates one system tick; the idle task calls it instead of waiting for an interrupt
+// port_ctx_handler switches the context (PendSV); it is called when the kernel is unlocked
+// port_irq_handler calls port_irq, if set, as an interrupt handler that is never masked by the kernel lock
+
+void port_tck_handler( void );
+void port_ctx_handler( void );
+void port_irq_handler( void );
+
+#define __WFI()             port_tck_handler()
+
+/* -------------------------------------------------------------------------- */
+// force yield system control to the next process
+
+void port_ctx_switch( void );
+
+/* -------------------------------------------------------------------------- */
+// reset context switch indicator
+
+__STATIC_INLINE
+void port_ctx_reset( void )
+{
+}
+
+/* -------------------------------------------------------------------------- */
+// clear time breakpoint
+
+__STATIC_INLINE
+void port_tmr_stop( void )
+{
+}
+
+/* -------------------------------------------------------------------------- */
+// set time breakpoint
+
+__STATIC_INLINE
+void port_tmr_start( uint32_t timeout )
+{
+	(void) timeout;
+}
+
+/* -------------------------------------------------------------------------- */
+// force timer interrupt
+
+__STATIC_INLINE
+void port_tmr_force( void )
+{
+}
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOSPORT_H
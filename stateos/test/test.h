@@ -0,0 +1,73 @@
+/******************************************************************************
+
+    @file    StateOS: test.h
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Common definitions of the host tests.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_TEST_H
+#define __STATEOS_TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* -------------------------------------------------------------------------- */
+// kernel asserts are enabled (DEBUG), test checks are independent of them
+
+#define TEST_CHECK( cond ) \
+        ((cond) ? (void)0 : test_fail(__FILE__, __LINE__, #cond))
+
+static inline
+void test_fail( const char *file, int line, const char *cond )
+{
+	fprintf(stderr, "%s:%d: check failed: %s\n", file, line, cond);
+	exit(EXIT_FAILURE);
+}
+
+/* -------------------------------------------------------------------------- */
+// deterministic pseudo-random generator
+
+static inline
+unsigned test_rand( void )
+{
+	static unsigned seed = 1U;
+	seed = seed * 1103515245U + 12345U;
+	return seed >> 16;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static inline
+int test_pass( const char *name )
+{
+	printf("%s: passed\n", name);
+	return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_TEST_H
@@ -0,0 +1,174 @@
+/******************************************************************************
+
+    @file    StateOS: test_async_queue.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Stress test of the async mailbox and event queues driven by an unmasked interrupt.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+
+#define ITEMS    20000
+#define LIMIT   (60*SEC)  // the test fails if any task has not finished by then
+
+static_BOX(rx, 4, sizeof(unsigned)); // interrupt -> two consuming tasks
+static_BOX(tx, 4, sizeof(unsigned)); // two producing tasks -> interrupt
+static_EVQ(ev, 4);                   // interrupt -> consuming task
+
+static volatile bool     IrqOn;      // the interrupt transfers data
+static volatile unsigned Release;    // number of final values to be sent to the parked consumers
+static volatile unsigned Done;       // number of finished tasks
+
+static unsigned RxNext, TxNext[2], EvNext;
+static unsigned char RxSeen[ITEMS];
+
+/* -------------------------------------------------------------------------- */
+// unmasked interrupt, raised on every change of the kernel lock state
+
+static void irq( void )
+{
+	unsigned val;
+
+	if (!IrqOn || test_rand() % 3 != 0)
+		return;
+
+	if (RxNext < ITEMS && box_giveAsync(rx, &RxNext) == E_SUCCESS)
+		RxNext++;
+	else
+	if (RxNext == ITEMS && Release > 0 && box_giveAsync(rx, &RxNext) == E_SUCCESS)
+		Release--;
+
+	if (EvNext < ITEMS && evq_giveAsync(ev, EvNext) == E_SUCCESS)
+		EvNext++;
+
+	if (box_takeAsync(tx, &val) == E_SUCCESS)
+	{
+		// values of each producer are received in order
+		TEST_CHECK(val / ITEMS < 2);
+		TEST_CHECK(val % ITEMS == TxNext[val / ITEMS]);
+		TxNext[val / ITEMS]++;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void consumer( void )
+{
+	unsigned val;
+
+	for (;;)
+	{
+		TEST_CHECK(box_waitAsync(rx, &val) == E_SUCCESS);
+		if (val == ITEMS)
+			break;
+		TEST_CHECK(val < ITEMS);
+		TEST_CHECK(RxSeen[val]++ == 0); // no value is received twice
+	}
+
+	Done++;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void events( void )
+{
+	unsigned val, i;
+
+	for (i = 0; i < ITEMS; i++)
+	{
+		TEST_CHECK(evq_waitAsync(ev, &val) == E_SUCCESS);
+		TEST_CHECK(val == i);
+	}
+
+	Done++;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void produce( unsigned id )
+{
+	unsigned val, i;
+
+	for (i = 0; i < ITEMS; i++)
+	{
+		val = id * ITEMS + i;
+		TEST_CHECK(box_sendAsync(tx, &val) == E_SUCCESS);
+	}
+
+	Done++;
+}
+
+static void producer0( void ) { produce(0); }
+static void producer1( void ) { produce(1); }
+
+/* -------------------------------------------------------------------------- */
+
+static void wait_for( unsigned done )
+{
+	while (Done < done && sys_time() < LIMIT)
+		tsk_sleepFor(1);
+
+	TEST_CHECK(Done == done);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	unsigned i;
+	unsigned long cnt;
+
+	port_irq = irq;
+	IrqOn = true;
+
+	tsk_new(2, consumer);
+	tsk_new(2, consumer);
+	tsk_new(2, events);
+	tsk_new(1, producer0);
+	tsk_new(1, producer1);
+
+	// all data is transferred; no value is lost
+	wait_for(3);
+	for (i = 0; i < ITEMS; i++)
+		TEST_CHECK(RxSeen[i] == 1);
+	TEST_CHECK(TxNext[0] == ITEMS && TxNext[1] == ITEMS);
+
+	// consumers waiting on the empty mailbox queue are parked, they are not resumed at every tick
+	cnt = port_cnt;
+	tsk_sleepFor(100);
+	TEST_CHECK(port_cnt - cnt <= 2);
+
+	// and the interrupt resumes them
+	Release = 2;
+	wait_for(5);
+
+	return test_pass("async_queue");
+}
+
+/* -------------------------------------------------------------------------- */
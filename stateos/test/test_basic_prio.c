@@ -0,0 +1,128 @@
+/******************************************************************************
+
+    @file    StateOS: test_basic_prio.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of a basic task re-sorted after the priority inheritance
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// two basic tasks of the same priority share one stack; the first one is started,
+// locks the mutex, gets the priority of the waiter and loses it when the mutex is reset
+// it must be continued before the second one is started on the shared stack
+
+static void procA( void );
+static void procB( void );
+static void procH( void );
+static void procX( void );
+
+static_MTX(mtx, mtxPrioInherit);
+static_TSK_STACK(stk);
+static_BAS(tskA, 1, procA, stk);
+static_BAS(tskB, 1, procB, stk);
+static_TSK(tskH, 2, procH);
+static_TSK(tskX, 3, procX);
+
+static volatile bool Go;     // the spinning task A may finish
+static volatile bool DoneA;
+static volatile bool DoneB;
+static volatile int  Result; // result of mtx_lock in task H
+
+/* -------------------------------------------------------------------------- */
+
+static void procA( void )
+{
+	TEST_CHECK(mtx_lock(mtx) == E_SUCCESS);
+	while (!Go) { sys_lock(); sys_unlock(); } // the emulated interrupt is raised here
+	DoneA = true;
+}
+
+static void procB( void )
+{
+	TEST_CHECK(DoneA);
+	DoneB = true;
+}
+
+static void procH( void )
+{
+	tsk_suspend(tskH);
+	Result = mtx_lock(mtx);
+}
+
+static void procX( void )
+{
+	tsk_suspend(tskX);
+	TEST_CHECK(tskA->prio == 2);
+	mtx_reset(mtx);
+	TEST_CHECK(tskA->prio == 1);
+	Go = true;
+}
+
+/* -------------------------------------------------------------------------- */
+// task H preempts the spinning task A and waits for the mutex, then task X resets the mutex
+
+static void irq( void )
+{
+	if (System.cur != tskA || mtx->owner != tskA)
+		return;
+
+	if (tskH->guard == &WAIT.obj.queue)
+		tsk_resumeISR(tskH);
+	else
+	if (tskH->guard == &mtx->obj.queue && tskX->guard == &WAIT.obj.queue)
+		tsk_resumeISR(tskX);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	// tasks H and X preempt main and suspend themselves
+	tsk_start(tskH);
+	tsk_start(tskX);
+	TEST_CHECK(tskH->guard == &WAIT.obj.queue && tskX->guard == &WAIT.obj.queue);
+
+	// main has the priority of the basic tasks, so they are started in order when main sleeps
+	tsk_prio(1);
+	tsk_start(tskA);
+	tsk_start(tskB);
+	TEST_CHECK(!DoneA && !DoneB);
+
+	port_irq = irq;
+	tsk_sleepFor(1);
+	port_irq = NULL;
+
+	TEST_CHECK(Result == E_STOPPED);
+	TEST_CHECK(DoneA && DoneB);
+
+	return test_pass("basic_prio");
+}
+
+/* -------------------------------------------------------------------------- */
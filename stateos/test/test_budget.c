@@ -0,0 +1,102 @@
+/******************************************************************************
+
+    @file    StateOS: test_budget.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the execution budgets
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// the task consumes the processor time calling port_tck_handler (the system tick interrupts the task)
+
+#define BUDGET    3
+#define PERIOD   10
+
+static unsigned Prio[PERIOD + 1]; // priority of the task after each tick
+static tsk_t *  Hooked;           // the task reported by the budget hook
+static volatile bool Low;         // the task of lower priority has run
+
+static void hook( tsk_t *tsk ) { Hooked = tsk; }
+
+/* -------------------------------------------------------------------------- */
+
+static void low( void )
+{
+	Low = true;
+}
+
+static void server( void )
+{
+	unsigned i;
+
+	tsk_setBudget(tsk_this(), BUDGET, PERIOD, 0);
+
+	for (i = 1; i <= PERIOD; i++)
+	{
+		port_tck_handler();
+		Prio[i] = tsk_this()->prio;
+		// the throttled task is preempted by the task of lower basic priority
+		if (i < BUDGET)
+			TEST_CHECK(!Low);
+		else
+		if (i == BUDGET)
+			TEST_CHECK(Low);
+	}
+
+	tsk_setBudget(tsk_this(), 0, 0, 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	tsk_t *srv;
+	unsigned i;
+
+	tsk_budgetHook(hook);
+
+	tsk_prio(3);
+	srv = tsk_new(2, server);
+	tsk_new(1, low);
+	TEST_CHECK(tsk_join(srv) == E_SUCCESS);
+
+	for (i = 1; i < BUDGET; i++)
+		TEST_CHECK(Prio[i] == 2);
+	for (i = BUDGET; i < PERIOD; i++)
+		TEST_CHECK(Prio[i] == 0);
+	TEST_CHECK(Prio[PERIOD] == 2); // the budget is replenished at the start of the next period
+
+	TEST_CHECK(Hooked == srv);
+	TEST_CHECK(tsk_getOverruns(srv) == 1);
+
+	return test_pass("budget");
+}
+
+/* -------------------------------------------------------------------------- */
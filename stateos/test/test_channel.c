@@ -0,0 +1,317 @@
+/******************************************************************************
+
+    @file    StateOS: test_channel.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the channel ring buffer
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <string.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#define sig_t host_sig_t // signal.h of the host defines sig_t too
+#include <signal.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#undef  sig_t
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// random transfers through both ends of the channel (sender and receiver) are checked against
+// a model fifo; the sizes of the buffers are not multiples of the transfers, so they wrap around
+
+#define STEPS    100000
+#define BYTES    13 // limit of the stream channel (in bytes)
+#define MSGS      3 // limit of the message channel (in messages)
+#define MSGSIZE  13 // max size of a message (in bytes)
+
+OS_CHN_BUFFER(StreamShm, BYTES, 0);
+OS_CHN_BUFFER(MessageShm, MSGS, MSGSIZE);
+
+static_CHN(streamTx, BYTES, 0, StreamShm, NULL);
+static_CHN(streamRx, BYTES, 0, StreamShm, NULL);
+
+static chn_t messageTx[1];
+static chn_t messageRx[1];
+
+/* -------------------------------------------------------------------------- */
+
+static char     Fifo[BYTES + 2 * MSGS * MSGSIZE]; // model fifo
+static size_t   FifoCount;
+static size_t   Sizes[2 * MSGS];              // sizes of the messages in the model fifo
+static size_t   SizeCount;
+static unsigned Seq;                          // value of the next byte sent
+
+static void fill( char *data, size_t size )
+{
+	while (size--) *data++ = (char)Seq++;
+}
+
+static void push( const char *data, size_t size )
+{
+	memcpy(Fifo + FifoCount, data, size);
+	FifoCount += size;
+}
+
+static void pop( const char *data, size_t size )
+{
+	TEST_CHECK(size <= FifoCount);
+	TEST_CHECK(memcmp(Fifo, data, size) == 0);
+	memmove(Fifo, Fifo + size, FifoCount - size);
+	FifoCount -= size;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void stream( void )
+{
+	char data[BYTES + 1];
+	size_t size, read;
+	unsigned i;
+
+	TEST_CHECK(chn_limit(streamTx) == BYTES);
+	TEST_CHECK(chn_give(streamTx, data, BYTES + 1) == E_FAILURE);
+
+	for (i = 0; i < STEPS; i++)
+	{
+		size = 1 + test_rand() % BYTES;
+		if (test_rand() % 2)
+		{
+			fill(data, size);
+			if (size > BYTES - FifoCount)
+				TEST_CHECK(chn_give(streamTx, data, size) == E_TIMEOUT);
+			else
+			{
+				TEST_CHECK(chn_give(streamTx, data, size) == E_SUCCESS);
+				push(data, size);
+			}
+		}
+		else
+		{
+			if (FifoCount == 0)
+				TEST_CHECK(chn_take(streamRx, data, size, &read) == E_TIMEOUT);
+			else
+			{
+				TEST_CHECK(chn_take(streamRx, data, size, &read) == E_SUCCESS);
+				TEST_CHECK(read == (size < FifoCount ? size : FifoCount));
+				pop(data, read);
+			}
+		}
+		TEST_CHECK(chn_count(streamRx) == FifoCount);
+		TEST_CHECK(chn_space(streamTx) == BYTES - FifoCount);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void message( void )
+{
+	char data[MSG_SIZE(MSGSIZE)];
+	size_t limit = chn_limit(messageTx); // the shared memory may have been rounded up
+	size_t size, read;
+	unsigned i;
+
+	TEST_CHECK(limit >= MSGS && limit <= 2 * MSGS);
+	TEST_CHECK(chn_give(messageTx, data, sizeof(data)) == E_FAILURE);
+	TEST_CHECK(chn_take(messageRx, data, 1, &read) == E_FAILURE);
+
+	for (i = 0; i < STEPS; i++)
+	{
+		size = 1 + test_rand() % MSGSIZE;
+		if (test_rand() % 2)
+		{
+			fill(data, size);
+			if (SizeCount == limit)
+				TEST_CHECK(chn_give(messageTx, data, size) == E_TIMEOUT);
+			else
+			{
+				TEST_CHECK(chn_give(messageTx, data, size) == E_SUCCESS);
+				push(data, size);
+				Sizes[SizeCount++] = size;
+			}
+		}
+		else
+		{
+			if (SizeCount == 0)
+				TEST_CHECK(chn_take(messageRx, data, MSGSIZE, &read) == E_TIMEOUT);
+			else
+			{
+				TEST_CHECK(chn_take(messageRx, data, MSGSIZE, &read) == E_SUCCESS);
+				TEST_CHECK(read == Sizes[0]);
+				pop(data, read);
+				memmove(Sizes, Sizes + 1, --SizeCount * sizeof(size_t));
+			}
+		}
+		TEST_CHECK(chn_count(messageRx) == SizeCount);
+		TEST_CHECK(chn_space(messageTx) == limit - SizeCount);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+// two kernel instances in two host processes share the channel buffers through the shared mapping;
+// the doorbell of each process is an eventfd, rung by the other process after every transfer;
+// the doorbell interrupt is taken when the kernel is idle and resumes the tasks waiting on both ends
+
+#define BLOCKS   20000 // number of transfers in each direction
+
+typedef struct
+{
+	OS_CHN_BUFFER(stream, BYTES, 0);         // parent -> child
+	OS_CHN_BUFFER(message, MSGS, MSGSIZE);   // child -> parent
+}	shm_t;
+
+static int      Doorbell[2]; // eventfd of each process
+static unsigned Self;        // 0: parent, 1: child
+static chn_t    LocalTx[1], LocalRx[1];
+
+static void ring( void )
+{
+	uint64_t one = 1;
+	TEST_CHECK(write(Doorbell[!Self], &one, sizeof(one)) == sizeof(one));
+}
+
+static void doorbell( void )
+{
+	struct pollfd pfd = { Doorbell[Self], POLLIN, 0 };
+	uint64_t cnt;
+
+	if (System.cur != &IDLE || port_isr_masked())
+		return;
+
+	// wait for the doorbell at most 1 ms while no task is ready, the ticks of the kernel are only delayed
+	if (poll(&pfd, 1, IDLE.hdr.next == &IDLE ? 1 : 0) > 0 && read(Doorbell[Self], &cnt, sizeof(cnt)) == sizeof(cnt))
+	{
+		chn_notifyISR(LocalTx);
+		chn_notifyISR(LocalRx);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void sender( chn_t *chn, size_t limit )
+{
+	char data[MSGSIZE];
+	size_t size;
+	unsigned i;
+
+	for (Seq = 0, i = 0; i < BLOCKS; i++)
+	{
+		size = 1 + i % limit;
+		fill(data, size);
+		TEST_CHECK(chn_send(chn, data, size) == E_SUCCESS);
+	}
+}
+
+// the stream is read in chunks of any size, messages are read whole;
+// the receiver gives up when the other process has stopped sending
+
+static void receiver( chn_t *chn, size_t limit )
+{
+	char data[MSGSIZE];
+	size_t total = 0, size, read;
+	unsigned seq = 0;
+	unsigned i;
+
+	for (i = 0; i < BLOCKS; i++)
+		total += 1 + i % limit;
+
+	for (i = 0; total > 0; i++)
+	{
+		TEST_CHECK(chn_waitFor(chn, data, MSGSIZE, &read, 10*SEC) == E_SUCCESS);
+		TEST_CHECK(read > 0 && read <= total);
+		TEST_CHECK(chn->size == 0 || read == 1 + i % limit);
+		for (size = 0; size < read; size++)
+			TEST_CHECK(data[size] == (char)seq++);
+		total -= read;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void processes( void )
+{
+	shm_t *shm = mmap(NULL, sizeof(shm_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	int status;
+	pid_t pid;
+
+	TEST_CHECK(shm != MAP_FAILED);
+	Doorbell[0] = eventfd(0, EFD_NONBLOCK);
+	Doorbell[1] = eventfd(0, EFD_NONBLOCK);
+	TEST_CHECK(Doorbell[0] >= 0 && Doorbell[1] >= 0);
+
+	pid = fork();
+	TEST_CHECK(pid >= 0);
+	Self = pid == 0;
+
+	if (Self == 0)
+	{
+		chn_init(LocalTx, 0, shm->stream, sizeof(shm->stream), ring);
+		chn_init(LocalRx, MSGSIZE, shm->message, sizeof(shm->message), ring);
+		port_irq = doorbell;
+		sender(LocalTx, BYTES);
+		receiver(LocalRx, MSGSIZE);
+		port_irq = NULL;
+
+		TEST_CHECK(waitpid(pid, &status, 0) == pid);
+		TEST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+	}
+	else
+	{
+		chn_init(LocalRx, 0, shm->stream, sizeof(shm->stream), ring);
+		chn_init(LocalTx, MSGSIZE, shm->message, sizeof(shm->message), ring);
+		port_irq = doorbell;
+		TEST_CHECK(prctl(PR_SET_PDEATHSIG, SIGKILL) == 0); // the child does not outlive the test
+		receiver(LocalRx, BYTES);
+		sender(LocalTx, MSGSIZE);
+		exit(EXIT_SUCCESS);
+	}
+
+	munmap(shm, sizeof(shm_t));
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	stream();
+
+	// the message channel is initialized at runtime by both ends
+	chn_init(messageTx, MSGSIZE, MessageShm, sizeof(MessageShm), NULL);
+	chn_init(messageRx, MSGSIZE, MessageShm, sizeof(MessageShm), NULL);
+	TEST_CHECK(FifoCount == chn_count(streamRx));
+	FifoCount = 0;
+	message();
+
+	processes();
+
+	return test_pass("channel");
+}
+
+/* -------------------------------------------------------------------------- */
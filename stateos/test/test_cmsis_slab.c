@@ -0,0 +1,244 @@
+/******************************************************************************
+
+    @file    StateOS: test_cmsis_slab.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Churn test of the CMSIS-RTOS2 slab pools.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include <malloc.h>
+#include "../cmsis/src/cmsis_os2.c" // access to the static slabs
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+
+#define SLOTS    8 // live objects of each type (more than slab blocks, so the heap is used as well)
+#define ROUNDS   20000
+
+#define IN_SLAB(ptr, buf) \
+        ((char *)(ptr) >= (char *)(buf) && (char *)(ptr) < (char *)(buf) + sizeof(buf))
+
+enum { T_THREAD, T_TIMER, T_FLAGS, T_MUTEX, T_SEMAPHORE, T_POOL, T_QUEUE, T_COUNT };
+
+static void    *Obj[T_COUNT][SLOTS];
+static unsigned Cls[SLOTS];           // stack class of slab threads (-1U: heap)
+static bool     Detached[SLOTS];
+static unsigned Live[T_COUNT];        // live slab blocks of non-thread types
+static unsigned LiveThreads[OS_CMSIS_STACK_CLASSES];
+static uint32_t StackSize;            // stack size requested by the last created thread
+
+static uint8_t  PoolMem[SLOTS][64];
+static uint8_t  QueueMem[SLOTS][64];
+
+static const unsigned Capacity[T_COUNT] = { 0, OS_CMSIS_TIMERS, OS_CMSIS_EVENT_FLAGS, OS_CMSIS_MUTEXES,
+                                            OS_CMSIS_SEMAPHORES, OS_CMSIS_MEMORY_POOLS, OS_CMSIS_MESSAGE_QUEUES };
+
+/* -------------------------------------------------------------------------- */
+
+static void worker( void *arg )
+{
+	(void) arg;
+	osThreadFlagsWait(1U, osFlagsWaitAny, osWaitForever);
+}
+
+static void callback( void *arg )
+{
+	(void) arg;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static bool in_slab( unsigned type, void *ptr )
+{
+	switch (type)
+	{
+	case T_TIMER:     return IN_SLAB(ptr, timer_buf);
+	case T_FLAGS:     return IN_SLAB(ptr, ef_buf);
+	case T_MUTEX:     return IN_SLAB(ptr, mutex_buf);
+	case T_SEMAPHORE: return IN_SLAB(ptr, semaphore_buf);
+	case T_POOL:      return IN_SLAB(ptr, mp_buf);
+	case T_QUEUE:     return IN_SLAB(ptr, mq_buf);
+	default:          return false;
+	}
+}
+
+static unsigned thread_class( void *ptr )
+{
+	if (IN_SLAB(ptr, thread_buf0)) return 0;
+	if (IN_SLAB(ptr, thread_buf1)) return 1;
+	return -1U;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void *create( unsigned type, unsigned slot )
+{
+	osThreadAttr_t       ta = { 0 };
+	osMemoryPoolAttr_t   pa = { 0 };
+	osMessageQueueAttr_t qa = { 0 };
+
+	switch (type)
+	{
+	case T_THREAD:
+		ta.attr_bits  = (Detached[slot] = test_rand() % 2) ? osThreadDetached : osThreadJoinable;
+		ta.priority   = osPriorityHigh;
+		ta.stack_size = (test_rand() % 3) * OS_STACK_SIZE; // class 0 (or default), class 1, heap
+		StackSize = osThreadStackSize(ta.stack_size);
+		return osThreadNew(worker, NULL, &ta);
+	case T_TIMER:
+		return osTimerNew(callback, osTimerOnce, NULL, NULL);
+	case T_FLAGS:
+		return osEventFlagsNew(NULL);
+	case T_MUTEX:
+		return osMutexNew(NULL);
+	case T_SEMAPHORE:
+		return osSemaphoreNew(4, 0, NULL);
+	case T_POOL:
+		pa.mp_mem  = PoolMem[slot];
+		pa.mp_size = osMemoryPoolMemSize(4, 16);
+		return osMemoryPoolNew(4, 16, &pa);
+	case T_QUEUE:
+		qa.mq_mem  = QueueMem[slot];
+		qa.mq_size = osMessageQueueMemSize(4, 8);
+		return osMessageQueueNew(4, 8, &qa);
+	default:
+		return NULL;
+	}
+}
+
+static void delete( unsigned type, unsigned slot, void *obj )
+{
+	switch (type)
+	{
+	case T_THREAD:
+		if (Detached[slot])
+			TEST_CHECK(osThreadFlagsSet(obj, 1U) == 1U); // the thread returns and is released by the idle task
+		else
+			TEST_CHECK(osThreadTerminate(obj) == osOK);
+		osDelay(1);
+		break;
+	case T_TIMER:     TEST_CHECK(osTimerDelete(obj) == osOK); break;
+	case T_FLAGS:     TEST_CHECK(osEventFlagsDelete(obj) == osOK); break;
+	case T_MUTEX:     TEST_CHECK(osMutexDelete(obj) == osOK); break;
+	case T_SEMAPHORE: TEST_CHECK(osSemaphoreDelete(obj) == osOK); break;
+	case T_POOL:      TEST_CHECK(osMemoryPoolDelete(obj) == osOK); break;
+	case T_QUEUE:     TEST_CHECK(osMessageQueueDelete(obj) == osOK); break;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void churn( void )
+{
+	unsigned type = test_rand() % T_COUNT;
+	unsigned slot = test_rand() % SLOTS;
+	unsigned i, cls;
+	void *obj = Obj[type][slot];
+
+	if (obj != NULL)
+	{
+		delete(type, slot, obj);
+		Obj[type][slot] = NULL;
+		if (type == T_THREAD)
+		{
+			if (Cls[slot] != -1U)
+				LiveThreads[Cls[slot]]--;
+		}
+		else
+		if (in_slab(type, obj))
+			Live[type]--;
+		return;
+	}
+
+	obj = create(type, slot);
+	TEST_CHECK(obj != NULL);
+	for (i = 0; i < SLOTS; i++)
+		TEST_CHECK(Obj[type][i] != obj); // a block is never handed out twice
+	Obj[type][slot] = obj;
+
+	if (type == T_THREAD)
+	{
+		// a thread takes the smallest class that fits and has a free block
+		cls = thread_class(obj);
+		Cls[slot] = cls;
+		if (cls == -1U)
+		{
+			for (i = 0; i < OS_CMSIS_STACK_CLASSES; i++)
+				TEST_CHECK(StackSize > THREAD_STACK_SIZE(i) || LiveThreads[i] == OS_CMSIS_THREADS);
+		}
+		else
+		{
+			for (i = 0; i < cls; i++)
+				TEST_CHECK(StackSize > THREAD_STACK_SIZE(i) || LiveThreads[i] == OS_CMSIS_THREADS);
+			LiveThreads[cls]++;
+		}
+		return;
+	}
+
+	// the slab is used as long as it has a free block
+	TEST_CHECK(in_slab(type, obj) == (Live[type] < Capacity[type]));
+	if (in_slab(type, obj))
+		Live[type]++;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	unsigned i, t;
+	size_t heap;
+
+	TEST_CHECK(osKernelInitialize() == osOK);
+	TEST_CHECK(osKernelStart() == osOK);
+
+	for (i = 0; i < ROUNDS; i++)
+		churn();
+
+	for (t = 0; t < T_COUNT; t++)
+		for (i = 0; i < SLOTS; i++)
+			if (Obj[t][i] != NULL)
+				delete(t, i, Obj[t][i]), Obj[t][i] = NULL;
+
+	// every slab block has been returned: the slabs serve their full capacity again
+	for (t = T_TIMER; t < T_COUNT; t++)
+	{
+		for (i = 0; i < Capacity[t]; i++)
+			TEST_CHECK(in_slab(t, Obj[t][i] = create(t, i)));
+		for (i = 0; i < Capacity[t]; i++)
+			delete(t, i, Obj[t][i]), Obj[t][i] = NULL;
+	}
+
+	// resources of native kernel objects are still released to the heap
+	sem_delete(sem_create(0, semCounting)); // the released block is kept in the allocator cache
+	heap = mallinfo2().uordblks;
+	for (i = 0; i < ROUNDS; i++)
+		sem_delete(sem_create(0, semCounting));
+	TEST_CHECK(mallinfo2().uordblks == heap);
+
+	return test_pass("cmsis_slab");
+}
+
+/* -------------------------------------------------------------------------- */
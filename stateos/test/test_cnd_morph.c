@@ -0,0 +1,102 @@
+/******************************************************************************
+
+    @file    StateOS: test_cnd_morph.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Test of condition variable waiters transferred to the mutex (wait morphing).
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+
+static_MTX(mtx, mtxDefault);
+static_CND(cnd);
+
+static volatile unsigned Done;       // number of finished waiters
+static volatile int      Result[2];  // results of cnd_wait
+static volatile bool     Owner[2];   // the mutex was locked again after cnd_wait
+
+/* -------------------------------------------------------------------------- */
+
+static void waiter( unsigned id )
+{
+	TEST_CHECK(mtx_lock(mtx) == E_SUCCESS);
+	Result[id] = cnd_wait(cnd, mtx);
+	Owner[id] = mtx->owner == tsk_this();
+	if (Owner[id])
+		TEST_CHECK(mtx_unlock(mtx) == E_SUCCESS);
+
+	Done++;
+}
+
+static void waiter0( void ) { waiter(0); }
+static void waiter1( void ) { waiter(1); }
+
+/* -------------------------------------------------------------------------- */
+
+static void run( bool reset )
+{
+	Done = 0;
+
+	// waiters have a higher priority than main, they block on the condition variable while main sleeps
+	tsk_new(1, waiter0);
+	tsk_new(1, waiter1);
+	tsk_sleepFor(1);
+	TEST_CHECK(Done == 0);
+	TEST_CHECK(cnd->obj.queue != NULL);
+
+	// notified waiters are transferred to the queue of the mutex owned by main
+	TEST_CHECK(mtx_lock(mtx) == E_SUCCESS);
+	cnd_notifyAll(cnd);
+	TEST_CHECK(cnd->obj.queue == NULL);
+	TEST_CHECK(Done == 0);
+
+	// the notification has been received in both cases; the mutex is locked again
+	if (reset)
+		mtx_reset(mtx);
+	else
+		TEST_CHECK(mtx_unlock(mtx) == E_SUCCESS);
+
+	tsk_sleepFor(1);
+	TEST_CHECK(Done == 2);
+	TEST_CHECK(Result[0] == E_SUCCESS && Result[1] == E_SUCCESS);
+	TEST_CHECK(Owner[0] && Owner[1]);
+	TEST_CHECK(mtx->owner == NULL);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	run(false);
+	run(true);
+
+	return test_pass("cnd_morph");
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,109 @@
+/******************************************************************************
+
+    @file    StateOS: test_edf.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the EDF scheduling class
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// time of the host port advances only when the idle task runs, or when a task calls port_tck_handler;
+// the latter emulates the system tick interrupting the running task (the task consumes the processor time)
+
+#define PERIOD   10
+
+static unsigned Order[3];   // order of execution of the jobs released at the same time
+static unsigned OrderCount;
+
+static void spin( unsigned ticks )
+{
+	while (ticks--) port_tck_handler();
+}
+
+/* -------------------------------------------------------------------------- */
+// jobs of the EDF class released at the same time are executed in the order of their deadlines
+
+static void job( unsigned id, cnt_t deadline )
+{
+	tsk_setPeriod(PERIOD, deadline);
+	TEST_CHECK(tsk_this()->prio == OS_EDF_PRIO);
+	TEST_CHECK(tsk_waitPeriod() == E_SUCCESS);
+	Order[OrderCount++] = id;
+}
+
+static void job0( void ) { job(0, 7); }
+static void job1( void ) { job(1, 3); }
+static void job2( void ) { job(2, 5); }
+
+/* -------------------------------------------------------------------------- */
+// jobs of the overloaded task released in the past are executed back-to-back, their deadlines are missed
+
+static volatile int Result[3];
+
+static void overload( void )
+{
+	cnt_t start;
+
+	tsk_setPeriod(PERIOD, 0);
+	start = sys_time();
+	spin(PERIOD * 2 + PERIOD / 2);
+
+	Result[0] = tsk_waitPeriod(); // the next job is already released
+	Result[1] = tsk_waitPeriod(); // as above
+	TEST_CHECK(sys_time() == start + PERIOD * 2 + PERIOD / 2);
+	Result[2] = tsk_waitPeriod(); // the deadline is met, the task waits for the next period
+	TEST_CHECK(sys_time() == start + PERIOD * 3);
+	TEST_CHECK(tsk_getMisses(tsk_this()) == 2);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	tsk_t *tsk[3];
+	unsigned i;
+
+	tsk[0] = tsk_new(OS_EDF_PRIO, job0);
+	tsk[1] = tsk_new(OS_EDF_PRIO, job1);
+	tsk[2] = tsk_new(OS_EDF_PRIO, job2);
+	for (i = 0; i < 3; i++)
+		TEST_CHECK(tsk_join(tsk[i]) == E_SUCCESS);
+
+	TEST_CHECK(OrderCount == 3);
+	TEST_CHECK(Order[0] == 1 && Order[1] == 2 && Order[2] == 0);
+
+	tsk[0] = tsk_new(OS_EDF_PRIO, overload);
+	TEST_CHECK(tsk_join(tsk[0]) == E_SUCCESS);
+	TEST_CHECK(Result[0] == E_FAILURE && Result[1] == E_FAILURE && Result[2] == E_SUCCESS);
+
+	return test_pass("edf");
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,165 @@
+/******************************************************************************
+
+    @file    StateOS: test_edf_util.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host simulation of the EDF class against fixed priorities above the RM bound
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// periodic task sets are simulated with rate monotonic fixed priorities and with the EDF class;
+// every job consumes its execution time with port_tck_handler (the tick interrupts the running task),
+// the kernel is preemptive (OS_ROBIN), so a released job of a higher priority preempts at once;
+// the relative deadline of every job is equal to its period
+// harmonic task sets are schedulable with fixed priorities up to the utilization of 100%,
+// task sets with other periods may miss deadlines above the RM bound n(2^(1/n) - 1), while EDF meets them
+
+#define CYCLES   10 // number of hyperperiods of each simulation
+
+typedef struct
+{
+	cnt_t    period;
+	cnt_t    work;   // execution time of each job
+	unsigned prio;   // rate monotonic priority
+	bool     edf;
+	cnt_t    start;  // release time of the first job
+	unsigned jobs;
+	unsigned misses;
+}	load_t;
+
+// the job completes with its last tick, even if a job released by this tick preempts it at once
+
+static cnt_t spin( cnt_t ticks )
+{
+	cnt_t end;
+
+	while (--ticks) port_tck_handler();
+
+	end = sys_time() + 1;
+	port_tck_handler();
+
+	return end;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void periodic( void *arg )
+{
+	load_t *ld = arg;
+	cnt_t release = ld->start;
+	unsigned i;
+
+	tsk_sleepUntil(release);
+	if (ld->edf)
+		tsk_setPeriod(ld->period, 0);
+
+	for (i = 0; i < ld->jobs; i++)
+	{
+		if (spin(ld->work) - release > ld->period)
+			ld->misses++;
+		release += ld->period;
+
+		if (ld->edf)
+			tsk_waitPeriod();
+		else
+		if (sys_time() - release > CNT_MAX / 2) // the next job has not been released yet
+			tsk_sleepUntil(release);
+	}
+
+	if (ld->edf)
+		TEST_CHECK(tsk_getMisses(tsk_this()) == ld->misses);
+}
+
+/* -------------------------------------------------------------------------- */
+// returns the number of missed deadlines
+
+static unsigned simulate( load_t *set, unsigned count, cnt_t hyperperiod, bool edf )
+{
+	tsk_t *tsk[3];
+	unsigned misses = 0;
+	unsigned i;
+
+	for (i = 0; i < count; i++)
+	{
+		set[i].edf    = edf;
+		set[i].start  = sys_time() + 1;
+		set[i].jobs   = CYCLES * hyperperiod / set[i].period;
+		set[i].misses = 0;
+		tsk[i] = tsk_setup(edf ? OS_EDF_PRIO : set[i].prio, periodic, &set[i], OS_STACK_SIZE);
+		TEST_CHECK(tsk[i] != NULL);
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		TEST_CHECK(tsk_join(tsk[i]) == E_SUCCESS);
+		misses += set[i].misses;
+	}
+
+	return misses;
+}
+
+static void compare( const char *name, load_t *set, unsigned count, cnt_t hyperperiod, bool fp_misses )
+{
+	double util = 0;
+	unsigned fp, edf;
+	unsigned i;
+
+	for (i = 0; i < count; i++)
+		util += (double)set[i].work / set[i].period;
+
+	fp  = simulate(set, count, hyperperiod, false);
+	edf = simulate(set, count, hyperperiod, true);
+
+	printf("%-13s U = %.3f: %3u missed deadlines with fixed priorities, %u with EDF\n", name, util, fp, edf);
+	TEST_CHECK(fp_misses ? fp > 0 : fp == 0);
+	TEST_CHECK(edf == 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	// RM bound for two tasks: 0.828
+	load_t harmonic2[] = { { .period = 4, .work = 2, .prio = 4 }, { .period = 8, .work = 4, .prio = 3 } };
+	load_t other2[]    = { { .period = 5, .work = 2, .prio = 4 }, { .period = 7, .work = 4, .prio = 3 } };
+	// RM bound for three tasks: 0.780
+	load_t harmonic3[] = { { .period = 4, .work = 1, .prio = 5 }, { .period = 8, .work = 3, .prio = 4 }, { .period = 16, .work = 5, .prio = 3 } };
+	load_t other3[]    = { { .period = 4, .work = 1, .prio = 5 }, { .period = 6, .work = 2, .prio = 4 }, { .period = 10, .work = 4, .prio = 3 } };
+
+	compare("harmonic",     harmonic2, 2,  8, false);
+	compare("harmonic",     harmonic3, 3, 16, false);
+	compare("non-harmonic", other2,    2, 35, true);
+	compare("non-harmonic", other3,    3, 60, true);
+
+	return test_pass("edf_util");
+}
+
+/* -------------------------------------------------------------------------- */
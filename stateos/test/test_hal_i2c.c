@@ -0,0 +1,237 @@
+/******************************************************************************
+
+    @file    StateOS: test_hal_i2c.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the i2c adapter with the mocked STM32 HAL
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <string.h>
+#include "hal_stateos_drivers.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// the mocked peripheral completes the transfer at once (with the callback of the real HAL),
+// unless the slave does not acknowledge, the completion is disabled or the abort misbehaves
+
+#if     USE_HAL_I2C_REGISTER_CALLBACKS == 1
+#define TX_CPLT( hi2c )     (hi2c)->MasterTxCpltCallback(hi2c)
+#define RX_CPLT( hi2c )     (hi2c)->MasterRxCpltCallback(hi2c)
+#define ERROR( hi2c )       (hi2c)->ErrorCallback(hi2c)
+#define ABORT_CPLT( hi2c )  (hi2c)->AbortCpltCallback(hi2c)
+#else
+#define TX_CPLT( hi2c )     HAL_I2C_MasterTxCpltCallback(hi2c)
+#define RX_CPLT( hi2c )     HAL_I2C_MasterRxCpltCallback(hi2c)
+#define ERROR( hi2c )       HAL_I2C_ErrorCallback(hi2c)
+#define ABORT_CPLT( hi2c )  HAL_I2C_AbortCpltCallback(hi2c)
+#endif
+
+static DMA_Stream_TypeDef streamTx, streamRx;
+static DMA_HandleTypeDef  dmaTx = { &streamTx, { DMA_NORMAL } };
+static DMA_HandleTypeDef  dmaRx = { &streamRx, { DMA_NORMAL } };
+
+static I2C_HandleTypeDef  i2c;
+static hal_i2c_t          dev;
+
+static const char *       Called;   // the last started HAL transfer
+static uint16_t           Address;  // address of the slave device of the last transfer
+static bool               Nack;     // the slave device does not acknowledge
+static bool               Silent;   // the transfer is not completed
+static bool               Refused;  // the abort is refused
+static bool               Lost;     // the abort is not completed
+static bool               Race;     // the transfer is completed before the abort
+static unsigned           Aborts;   // number of the aborts
+
+/* -------------------------------------------------------------------------- */
+
+#if     USE_HAL_I2C_REGISTER_CALLBACKS == 1
+
+HAL_StatusTypeDef HAL_I2C_RegisterCallback( I2C_HandleTypeDef *hi2c, HAL_I2C_CallbackIDTypeDef CallbackID, pI2C_CallbackTypeDef pCallback )
+{
+	switch (CallbackID)
+	{
+	case HAL_I2C_MASTER_TX_COMPLETE_CB_ID: hi2c->MasterTxCpltCallback = pCallback; break;
+	case HAL_I2C_MASTER_RX_COMPLETE_CB_ID: hi2c->MasterRxCpltCallback = pCallback; break;
+	case HAL_I2C_ERROR_CB_ID:              hi2c->ErrorCallback        = pCallback; break;
+	case HAL_I2C_ABORT_CB_ID:              hi2c->AbortCpltCallback    = pCallback; break;
+	}
+	return HAL_OK;
+}
+
+#endif//USE_HAL_I2C_REGISTER_CALLBACKS
+
+static HAL_StatusTypeDef complete( I2C_HandleTypeDef *hi2c, const char *name, uint16_t addr, uint8_t *rx, uint16_t size )
+{
+	Called  = name;
+	Address = addr;
+	if (Nack)
+		ERROR(hi2c);
+	else
+	if (Silent)
+		return HAL_OK;
+	else
+	if (rx != NULL)
+	{
+		memset(rx, 0xA5, size);
+		RX_CPLT(hi2c);
+	}
+	else
+		TX_CPLT(hi2c);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT( I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size )
+{
+	(void) pData;
+	return complete(hi2c, "Transmit_IT", DevAddress, NULL, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive_IT( I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size )
+{
+	return complete(hi2c, "Receive_IT", DevAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA( I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size )
+{
+	(void) pData;
+	TEST_CHECK(hi2c->hdmatx != NULL);
+	return complete(hi2c, "Transmit_DMA", DevAddress, NULL, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA( I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size )
+{
+	TEST_CHECK(hi2c->hdmarx != NULL);
+	return complete(hi2c, "Receive_DMA", DevAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Abort_IT( I2C_HandleTypeDef *hi2c, uint16_t DevAddress )
+{
+	TEST_CHECK(DevAddress == Address);
+	Aborts++;
+	if (Refused)
+		return HAL_ERROR;
+	if (Race)
+		TX_CPLT(hi2c);
+	else
+	if (!Lost)
+		ABORT_CPLT(hi2c);
+	return HAL_OK;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void setup( DMA_HandleTypeDef *tx, DMA_HandleTypeDef *rx )
+{
+	i2c.hdmatx = tx;
+	i2c.hdmarx = rx;
+	Called  = NULL;
+	Address = 0;
+	Nack    = false;
+	Silent  = false;
+	Refused = false;
+	Lost    = false;
+	Race    = false;
+	Aborts  = 0;
+}
+
+static void check( bool rx, const char *expected )
+{
+	uint8_t buf[4] = { 0 };
+
+	if (rx)
+		TEST_CHECK(hal_i2c_read(&dev, 0xA0, buf, sizeof(buf), 10) == HAL_OK);
+	else
+		TEST_CHECK(hal_i2c_write(&dev, 0xA0, buf, sizeof(buf), 10) == HAL_OK);
+	TEST_CHECK(Called != NULL && strcmp(Called, expected) == 0);
+	TEST_CHECK(Address == 0xA0);
+	if (rx)
+		TEST_CHECK(buf[0] == 0xA5 && buf[3] == 0xA5);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	static const uint8_t txd[4] = { 1, 2, 3, 4 };
+	uint8_t rxd[4];
+	cnt_t start;
+
+	hal_i2c_init(&dev, &i2c);
+
+	// completion of the transfers in the interrupt and DMA modes
+	setup(NULL, NULL);
+	check(false, "Transmit_IT");
+	check(true, "Receive_IT");
+	setup(&dmaTx, NULL);
+	check(false, "Transmit_DMA");
+	check(true, "Receive_IT");
+	setup(NULL, &dmaRx);
+	check(false, "Transmit_IT");
+	check(true, "Receive_DMA");
+
+	// the slave device does not acknowledge
+	setup(&dmaTx, &dmaRx);
+	Nack = true;
+	TEST_CHECK(hal_i2c_write(&dev, 0xA0, txd, sizeof(txd), 10) == HAL_ERROR);
+	TEST_CHECK(hal_i2c_read(&dev, 0xA0, rxd, sizeof(rxd), 10) == HAL_ERROR);
+	TEST_CHECK(Aborts == 0);
+
+	// timeout of the transfer: the abort is completed in the interrupt handler
+	setup(&dmaTx, &dmaRx);
+	Silent = true;
+	start = sys_time();
+	TEST_CHECK(hal_i2c_write(&dev, 0xA0, txd, sizeof(txd), 10) == HAL_TIMEOUT);
+	TEST_CHECK(sys_time() - start >= 10 && Aborts == 1);
+
+	// the abort is refused or it is never completed
+	Refused = true;
+	TEST_CHECK(hal_i2c_read(&dev, 0xA0, rxd, sizeof(rxd), 10) == HAL_TIMEOUT);
+	TEST_CHECK(Aborts == 2);
+	Refused = false;
+	Lost = true;
+	start = sys_time();
+	TEST_CHECK(hal_i2c_write(&dev, 0xA0, txd, sizeof(txd), 10) == HAL_TIMEOUT);
+	TEST_CHECK(sys_time() - start >= 20 && Aborts == 3);
+
+	// the late completion of the abort does not complete the next transfer
+	ABORT_CPLT(&i2c);
+	TEST_CHECK(hal_i2c_write(&dev, 0xA0, txd, sizeof(txd), 10) == HAL_TIMEOUT);
+	TEST_CHECK(Aborts == 4);
+
+	// the transfer completed before its abort succeeds
+	Lost = false;
+	Race = true;
+	TEST_CHECK(hal_i2c_write(&dev, 0xA0, txd, sizeof(txd), 10) == HAL_OK);
+	TEST_CHECK(Aborts == 5);
+
+	setup(&dmaTx, &dmaRx);
+	check(false, "Transmit_DMA");
+
+	return test_pass("hal_i2c");
+}
+
+/* -------------------------------------------------------------------------- */
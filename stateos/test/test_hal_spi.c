@@ -0,0 +1,186 @@
+/******************************************************************************
+
+    @file    StateOS: test_hal_spi.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the spi adapter with the mocked STM32 HAL
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <string.h>
+#include "hal_stateos_drivers.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// the mocked peripheral completes the transfer at once (with the callback of the real HAL),
+// unless the completion is disabled or an error is injected
+
+static DMA_HandleTypeDef dmaTx, dmaRx;
+static SPI_HandleTypeDef spi;
+static hal_spi_t         dev;
+
+static const char *      Called;   // the last started HAL transfer
+static bool              Silent;   // the transfer is not completed
+static bool              Error;    // the transfer ends with an error
+static bool              Aborted;  // HAL_SPI_Abort was called
+
+/* -------------------------------------------------------------------------- */
+
+static HAL_StatusTypeDef complete( SPI_HandleTypeDef *hspi, const char *name, uint8_t *rx, uint16_t size, void (*callback)(SPI_HandleTypeDef *) )
+{
+	Called = name;
+	if (rx != NULL)
+		memset(rx, 0xA5, size);
+	if (Error)
+		HAL_SPI_ErrorCallback(hspi);
+	else
+	if (!Silent)
+		callback(hspi);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_IT( SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size )
+{
+	(void) pData;
+	return complete(hspi, "Transmit_IT", NULL, Size, HAL_SPI_TxCpltCallback);
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive_IT( SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size )
+{
+	return complete(hspi, "Receive_IT", pData, Size, HAL_SPI_RxCpltCallback);
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT( SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size )
+{
+	(void) pTxData;
+	return complete(hspi, "TransmitReceive_IT", pRxData, Size, HAL_SPI_TxRxCpltCallback);
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA( SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size )
+{
+	(void) pData;
+	TEST_CHECK(hspi->hdmatx != NULL);
+	return complete(hspi, "Transmit_DMA", NULL, Size, HAL_SPI_TxCpltCallback);
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA( SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size )
+{
+	(void) pTxData;
+	TEST_CHECK(hspi->hdmatx != NULL && hspi->hdmarx != NULL); // the real HAL dereferences both handles
+	return complete(hspi, "TransmitReceive_DMA", pRxData, Size, HAL_SPI_TxRxCpltCallback);
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive_DMA( SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size )
+{
+	TEST_CHECK(hspi->hdmarx != NULL);
+	// the real HAL forwards the reception of the full-duplex master
+	if (hspi->Init.Mode == SPI_MODE_MASTER && hspi->Init.Direction == SPI_DIRECTION_2LINES)
+		return HAL_SPI_TransmitReceive_DMA(hspi, pData, pData, Size);
+	return complete(hspi, "Receive_DMA", pData, Size, HAL_SPI_RxCpltCallback);
+}
+
+HAL_StatusTypeDef HAL_SPI_Abort( SPI_HandleTypeDef *hspi )
+{
+	(void) hspi;
+	Aborted = true;
+	return HAL_OK;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void setup( uint32_t mode, uint32_t direction, DMA_HandleTypeDef *tx, DMA_HandleTypeDef *rx )
+{
+	spi.Init.Mode      = mode;
+	spi.Init.Direction = direction;
+	spi.hdmatx         = tx;
+	spi.hdmarx         = rx;
+	Called  = NULL;
+	Silent  = false;
+	Error   = false;
+	Aborted = false;
+}
+
+static void check( const void *txd, bool rx, const char *expected )
+{
+	uint8_t buf[4] = { 0 };
+
+	TEST_CHECK(hal_spi_transfer(&dev, txd, rx ? buf : NULL, sizeof(buf), 10) == HAL_OK);
+	TEST_CHECK(Called != NULL && strcmp(Called, expected) == 0);
+	if (rx)
+		TEST_CHECK(buf[0] == 0xA5 && buf[3] == 0xA5);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	static const uint8_t txd[4] = { 1, 2, 3, 4 };
+	uint8_t rxd[4];
+
+	hal_spi_init(&dev, &spi);
+
+	// reception of the full-duplex master uses DMA only with both channels
+	setup(SPI_MODE_MASTER, SPI_DIRECTION_2LINES, NULL, &dmaRx);
+	check(NULL, true, "Receive_IT");
+	setup(SPI_MODE_MASTER, SPI_DIRECTION_2LINES, &dmaTx, &dmaRx);
+	check(NULL, true, "TransmitReceive_DMA");
+
+	// reception of the slave and of the receive-only master needs the reception channel only
+	setup(SPI_MODE_SLAVE, SPI_DIRECTION_2LINES, NULL, &dmaRx);
+	check(NULL, true, "Receive_DMA");
+	setup(SPI_MODE_MASTER, SPI_DIRECTION_2LINES_RXONLY, NULL, &dmaRx);
+	check(NULL, true, "Receive_DMA");
+	setup(SPI_MODE_MASTER, SPI_DIRECTION_2LINES, NULL, NULL);
+	check(NULL, true, "Receive_IT");
+
+	// transmission and full-duplex transfers
+	setup(SPI_MODE_MASTER, SPI_DIRECTION_2LINES, &dmaTx, NULL);
+	check(txd, false, "Transmit_DMA");
+	check(txd, true, "TransmitReceive_IT");
+	setup(SPI_MODE_MASTER, SPI_DIRECTION_2LINES, NULL, NULL);
+	check(txd, false, "Transmit_IT");
+	setup(SPI_MODE_MASTER, SPI_DIRECTION_2LINES, &dmaTx, &dmaRx);
+	check(txd, true, "TransmitReceive_DMA");
+
+	// error and timeout of the transfer
+	setup(SPI_MODE_MASTER, SPI_DIRECTION_2LINES, &dmaTx, &dmaRx);
+	Error = true;
+	TEST_CHECK(hal_spi_transfer(&dev, txd, rxd, sizeof(rxd), 10) == HAL_ERROR);
+	TEST_CHECK(!Aborted);
+	setup(SPI_MODE_MASTER, SPI_DIRECTION_2LINES, &dmaTx, &dmaRx);
+	Silent = true;
+	TEST_CHECK(hal_spi_transfer(&dev, txd, rxd, sizeof(rxd), 10) == HAL_TIMEOUT);
+	TEST_CHECK(Aborted);
+
+	// the late completion of the aborted transfer does not complete the next one
+	HAL_SPI_TxRxCpltCallback(&spi);
+	Silent = false;
+	check(txd, true, "TransmitReceive_DMA");
+
+	return test_pass("hal_spi");
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,302 @@
+/******************************************************************************
+
+    @file    StateOS: test_hal_uart.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the uart adapter with the mocked STM32 HAL
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <string.h>
+#include "hal_stateos_drivers.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// the test plays the role of the uart peripheral and of the interrupt handlers of the real HAL;
+// the DMA stream is modelled by its counter register (NDTR) and the mode of the channel
+
+#if     USE_HAL_UART_REGISTER_CALLBACKS == 1
+#define TX_CPLT( huart )         (huart)->TxCpltCallback(huart)
+#define RX_EVENT( huart, size )  (huart)->RxEventCallback(huart, size)
+#define ERROR( huart )           (huart)->ErrorCallback(huart)
+#else
+#define TX_CPLT( huart )         HAL_UART_TxCpltCallback(huart)
+#define RX_EVENT( huart, size )  HAL_UARTEx_RxEventCallback(huart, size)
+#define ERROR( huart )           HAL_UART_ErrorCallback(huart)
+#endif
+
+static DMA_Stream_TypeDef streamTx, streamRx;
+static DMA_HandleTypeDef  dmaTx = { &streamTx, { DMA_NORMAL } };
+static DMA_HandleTypeDef  dmaRx = { &streamRx, { DMA_CIRCULAR } };
+
+static UART_HandleTypeDef uart[3];
+static hal_uart_t         dev[3];
+static_RAW(raw, 256);
+
+static unsigned           Starts;   // number of started receptions
+static bool               Silent;   // the transmission is not completed
+static bool               Error;    // the transmission ends with an error
+static bool               Aborted;  // HAL_UART_AbortTransmit was called
+
+/* -------------------------------------------------------------------------- */
+
+#if     USE_HAL_UART_REGISTER_CALLBACKS == 1
+
+HAL_StatusTypeDef HAL_UART_RegisterCallback( UART_HandleTypeDef *huart, HAL_UART_CallbackIDTypeDef CallbackID, pUART_CallbackTypeDef pCallback )
+{
+	TEST_CHECK(huart->gState == HAL_UART_STATE_READY);
+	switch (CallbackID)
+	{
+	case HAL_UART_TX_COMPLETE_CB_ID: huart->TxCpltCallback = pCallback; break;
+	case HAL_UART_ERROR_CB_ID:       huart->ErrorCallback  = pCallback; break;
+	}
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_RegisterRxEventCallback( UART_HandleTypeDef *huart, pUART_RxEventCallbackTypeDef pCallback )
+{
+	TEST_CHECK(huart->RxState == HAL_UART_STATE_READY);
+	huart->RxEventCallback = pCallback;
+	return HAL_OK;
+}
+
+#endif//USE_HAL_UART_REGISTER_CALLBACKS
+
+static HAL_StatusTypeDef transmit( UART_HandleTypeDef *huart )
+{
+	if (huart->gState != HAL_UART_STATE_READY)
+		return HAL_BUSY;
+	huart->gState = HAL_UART_STATE_BUSY_TX;
+	if (Error)
+	{
+		huart->gState = HAL_UART_STATE_READY; // the transmission is aborted by the error
+		ERROR(huart);
+	}
+	else
+	if (!Silent)
+	{
+		huart->gState = HAL_UART_STATE_READY;
+		TX_CPLT(huart);
+	}
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_IT( UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size )
+{
+	(void) pData; (void) Size;
+	TEST_CHECK(huart->hdmatx == NULL);
+	return transmit(huart);
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA( UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size )
+{
+	(void) pData; (void) Size;
+	TEST_CHECK(huart->hdmatx != NULL);
+	return transmit(huart);
+}
+
+HAL_StatusTypeDef HAL_UART_AbortTransmit( UART_HandleTypeDef *huart )
+{
+	huart->gState = HAL_UART_STATE_READY;
+	Aborted = true;
+	return HAL_OK;
+}
+
+static HAL_StatusTypeDef receive( UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size )
+{
+	TEST_CHECK(huart->RxState == HAL_UART_STATE_READY);
+	huart->pRxBuffPtr  = pData;
+	huart->RxXferSize  = Size;
+	huart->RxXferCount = Size;
+	huart->RxState     = HAL_UART_STATE_BUSY_RX;
+	Starts++;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT( UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size )
+{
+	TEST_CHECK(huart->hdmarx == NULL);
+	return receive(huart, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA( UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size )
+{
+	TEST_CHECK(huart->hdmarx != NULL);
+	huart->hdmarx->Instance->NDTR = Size;
+	return receive(huart, pData, Size);
+}
+
+/* -------------------------------------------------------------------------- */
+// reception of a byte: the DMA reports the half and the end of the buffer,
+// the interrupt mode reports the end of the buffer only
+
+static void rx_byte( UART_HandleTypeDef *huart, uint8_t byte )
+{
+	DMA_HandleTypeDef *hdma = huart->hdmarx;
+	uint16_t size = huart->RxXferSize;
+
+	TEST_CHECK(huart->RxState == HAL_UART_STATE_BUSY_RX); // the adapter never leaves the reception stopped
+
+	if (hdma != NULL)
+	{
+		huart->pRxBuffPtr[size - __HAL_DMA_GET_COUNTER(hdma)] = byte;
+		if (--hdma->Instance->NDTR == size / 2)
+			RX_EVENT(huart, size / 2);
+		else
+		if (__HAL_DMA_GET_COUNTER(hdma) == 0)
+		{
+			if (hdma->Init.Mode == DMA_CIRCULAR)
+				hdma->Instance->NDTR = size;
+			else
+				huart->RxState = HAL_UART_STATE_READY;
+			RX_EVENT(huart, size);
+		}
+	}
+	else
+	{
+		huart->pRxBuffPtr[size - huart->RxXferCount] = byte;
+		if (--huart->RxXferCount == 0)
+		{
+			huart->RxState = HAL_UART_STATE_READY;
+			RX_EVENT(huart, size);
+		}
+	}
+}
+
+// idle line: the reception is reported if the buffer is partially filled;
+// only the circular DMA continues the reception
+
+static void rx_idle( UART_HandleTypeDef *huart )
+{
+	DMA_HandleTypeDef *hdma = huart->hdmarx;
+	uint16_t size = huart->RxXferSize;
+	uint16_t remaining = hdma != NULL ? __HAL_DMA_GET_COUNTER(hdma) : huart->RxXferCount;
+
+	if (remaining > 0 && remaining < size)
+	{
+		if (hdma == NULL || hdma->Init.Mode != DMA_CIRCULAR)
+			huart->RxState = HAL_UART_STATE_READY;
+		RX_EVENT(huart, size - remaining);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+// the frames of the growing sizes are streamed through the reception buffer (several times around)
+// and must be read from the raw buffer in order and without gaps
+
+static void stream( hal_uart_t *dev, UART_HandleTypeDef *huart, DMA_HandleTypeDef *hdma )
+{
+	static uint8_t next = 0, data[HAL_UART_BUFFER * 2 + 8];
+	size_t frame, i, read, total;
+
+	huart->gState  = HAL_UART_STATE_READY;
+	huart->RxState = HAL_UART_STATE_READY;
+	huart->hdmarx  = hdma;
+	Starts = 0;
+	hal_uart_init(dev, huart, raw);
+	TEST_CHECK(Starts == 1);
+
+	for (frame = 1; frame <= sizeof(data); frame += 7)
+	{
+		uint8_t first = next;
+		for (i = 0; i < frame; i++)
+			rx_byte(huart, next++);
+		rx_idle(huart);
+
+		for (total = 0; total < frame; total += read)
+			TEST_CHECK(hal_uart_recv(dev, &data[total], sizeof(data) - total, &read, 10) == HAL_OK);
+		TEST_CHECK(total == frame);
+		for (i = 0; i < frame; i++)
+			TEST_CHECK(data[i] == (uint8_t)(first + i));
+	}
+
+	// nothing more was received
+	TEST_CHECK(hal_uart_recv(dev, data, sizeof(data), &read, 10) == HAL_TIMEOUT);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	static const uint8_t txd[4] = { 1, 2, 3, 4 };
+	static hal_uart_t tx;
+	static UART_HandleTypeDef txuart;
+	size_t read;
+	uint8_t byte;
+
+	// circular DMA: the reception is started once and wraps around the buffer
+	stream(&dev[0], &uart[0], &dmaRx);
+	TEST_CHECK(Starts == 1);
+
+	// normal DMA and interrupt mode: the reception is restarted after every idle line or full buffer
+	dmaRx.Init.Mode = DMA_NORMAL;
+	stream(&dev[1], &uart[1], &dmaRx);
+	TEST_CHECK(Starts > 1);
+	stream(&dev[2], &uart[2], NULL);
+	TEST_CHECK(Starts > 1);
+
+	// the reception aborted by an error is restarted
+	rx_byte(&uart[2], 0x5A);
+	uart[2].RxState = HAL_UART_STATE_READY;
+	Starts = 0;
+	ERROR(&uart[2]);
+	TEST_CHECK(Starts == 1);
+	rx_byte(&uart[2], 0xA5);
+	rx_idle(&uart[2]);
+	TEST_CHECK(hal_uart_recv(&dev[2], &byte, 1, &read, 10) == HAL_OK && read == 1 && byte == 0xA5);
+
+	// the adapter without the reception
+	txuart.gState  = HAL_UART_STATE_READY;
+	txuart.RxState = HAL_UART_STATE_READY;
+	hal_uart_init(&tx, &txuart, NULL);
+	TEST_CHECK(hal_uart_recv(&tx, &byte, 1, &read, 10) == HAL_ERROR);
+	txuart.hdmatx = &dmaTx;
+	TEST_CHECK(hal_uart_send(&tx, txd, sizeof(txd), 10) == HAL_OK);
+	txuart.hdmatx = NULL;
+	TEST_CHECK(hal_uart_send(&tx, txd, sizeof(txd), 10) == HAL_OK);
+
+	// error and timeout of the transmission
+	Error = true;
+	TEST_CHECK(hal_uart_send(&tx, txd, sizeof(txd), 10) == HAL_ERROR);
+	TEST_CHECK(!Aborted);
+	Error = false;
+	Silent = true;
+	TEST_CHECK(hal_uart_send(&tx, txd, sizeof(txd), 10) == HAL_TIMEOUT);
+	TEST_CHECK(Aborted);
+
+	// the late completion of the aborted transmission does not complete the next one
+	TX_CPLT(&txuart);
+	txuart.gState = HAL_UART_STATE_BUSY_TX;
+	TEST_CHECK(hal_uart_send(&tx, txd, sizeof(txd), 10) == HAL_BUSY);
+	txuart.gState = HAL_UART_STATE_READY;
+	TEST_CHECK(hal_uart_send(&tx, txd, sizeof(txd), 10) == HAL_TIMEOUT);
+	Silent = false;
+	TEST_CHECK(hal_uart_send(&tx, txd, sizeof(txd), 10) == HAL_OK);
+
+	return test_pass("hal_uart");
+}
+
+/* -------------------------------------------------------------------------- */
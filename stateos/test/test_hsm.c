@@ -0,0 +1,258 @@
+/******************************************************************************
+
+    @file    StateOS: test_hsm.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the hsm event lanes (coalesced, urgent and deferred events)
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// state A handles E1, E2, EU, defers D1..D3 and goes to state B on EGO; state B handles all user events
+// handlers log the state (1: A, 2: B) and the event; the dispatcher has a higher priority than main,
+// but the kernel is cooperative, so events are dispatched when main sleeps
+
+enum { E1 = hsmUser, E2, EU, EGO, D1, D2, D3 };
+
+static_HSM(sm, 8);
+static_TSK(dsp, 1, NULL);
+
+static hsm_state_t  A[1], B[1];
+static hsm_action_t Act[8];
+
+static unsigned Log[16];
+static unsigned Count;
+
+/* -------------------------------------------------------------------------- */
+
+static void handlerA( hsm_t *hsm, unsigned event )
+{
+	(void) hsm;
+
+	if (event >= hsmUser && Count < 16)
+		Log[Count++] = 100 + event;
+}
+
+static void handlerB( hsm_t *hsm, unsigned event )
+{
+	(void) hsm;
+
+	if (event >= hsmUser && Count < 16)
+		Log[Count++] = 200 + event;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static void check( unsigned count, const unsigned *log )
+{
+	unsigned i;
+
+	TEST_CHECK(Count == count);
+	for (i = 0; i < count; i++)
+		TEST_CHECK(Log[i] == log[i]);
+
+	Count = 0;
+}
+
+#define CHECK( ... ) \
+        check(sizeof((unsigned[]){ __VA_ARGS__ }) / sizeof(unsigned), (unsigned[]){ __VA_ARGS__ })
+
+/* -------------------------------------------------------------------------- */
+
+static void init( void )
+{
+	hsm_initState(A, NULL);
+	hsm_initState(B, NULL);
+
+	hsm_initAction(&Act[0], A, E1,  NULL, handlerA);
+	hsm_initAction(&Act[1], A, E2,  NULL, handlerA);
+	hsm_initAction(&Act[2], A, EU,  NULL, handlerA);
+	hsm_initAction(&Act[3], A, EGO, B,    NULL);
+	hsm_initAction(&Act[7], B, hsmALL, NULL, handlerB);
+#if OS_HSM_DEFER
+	hsm_initAction(&Act[4], A, D1,  NULL, hsm_defer);
+	hsm_initAction(&Act[5], A, D2,  NULL, hsm_defer);
+	hsm_initAction(&Act[6], A, D3,  NULL, hsm_defer);
+#else
+	hsm_initAction(&Act[4], A, D1,  NULL, handlerA);
+	hsm_initAction(&Act[5], A, D2,  NULL, handlerA);
+	hsm_initAction(&Act[6], A, D3,  NULL, handlerA);
+#endif
+
+	for (unsigned i = 0; i < 8; i++)
+		hsm_link(&Act[i]);
+}
+
+/* -------------------------------------------------------------------------- */
+// the first event is handed over to the waiting dispatcher, the next ones are queued;
+// a coalesced event is not posted again until it has been dispatched
+
+static void test_coalesce( void )
+{
+	TEST_CHECK(hsm_give(sm, E1) == E_SUCCESS);
+	TEST_CHECK(hsm_give(sm, E1) == E_SUCCESS);
+	TEST_CHECK(hsm_give(sm, E2) == E_SUCCESS);
+	TEST_CHECK(hsm_give(sm, E1) == E_SUCCESS);
+	TEST_CHECK(hsm_give(sm, E2) == E_SUCCESS);
+	TEST_CHECK(sm->evq.count == 2);
+	tsk_sleepFor(1);
+	CHECK(100 + E1, 100 + E2, 100 + E2);
+
+	TEST_CHECK(hsm_give(sm, E1) == E_SUCCESS);
+	TEST_CHECK(hsm_give(sm, E1) == E_SUCCESS);
+	tsk_sleepFor(1);
+	CHECK(100 + E1);
+}
+
+/* -------------------------------------------------------------------------- */
+// urgent events are dispatched before the queued ones, in order; coalescing applies to the urgent lane too
+
+#if OS_HSM_URGENT
+
+static void test_urgent( void )
+{
+	unsigned i;
+
+	TEST_CHECK(hsm_give(sm, E1) == E_SUCCESS);
+	TEST_CHECK(hsm_give(sm, E2) == E_SUCCESS);
+	TEST_CHECK(hsm_giveUrgent(sm, E1) == E_SUCCESS); // coalesced
+	for (i = 0; i < OS_HSM_URGENT; i++)
+		TEST_CHECK(hsm_giveUrgent(sm, EU) == E_SUCCESS);
+	TEST_CHECK(hsm_giveUrgent(sm, EU) == E_TIMEOUT);
+	tsk_sleepFor(1);
+	CHECK(100 + E1, 100 + EU, 100 + EU, 100 + EU, 100 + EU, 100 + E2);
+
+	// the urgent event wakes up the waiting dispatcher
+	TEST_CHECK(hsm_giveUrgent(sm, EU) == E_SUCCESS);
+	tsk_sleepFor(1);
+	CHECK(100 + EU);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+// deferred events are recalled after the transition, before the queued events;
+// the oldest deferred event is removed when there is no space, a deferred coalesced event stays pending
+
+#if OS_HSM_DEFER
+
+static void test_defer( void )
+{
+	hsm_coalesce(sm, D3);
+
+	TEST_CHECK(hsm_give(sm, D1) == E_SUCCESS);
+	TEST_CHECK(hsm_give(sm, D2) == E_SUCCESS);
+	TEST_CHECK(hsm_give(sm, D3) == E_SUCCESS);
+	tsk_sleepFor(1);
+	CHECK();
+	TEST_CHECK(sm->dcount == 2);
+
+	TEST_CHECK(hsm_give(sm, D3) == E_SUCCESS); // coalesced
+	TEST_CHECK(hsm_give(sm, E2) == E_SUCCESS);
+	TEST_CHECK(hsm_give(sm, EGO) == E_SUCCESS);
+	TEST_CHECK(hsm_give(sm, E1) == E_SUCCESS);
+	tsk_sleepFor(1);
+	CHECK(100 + E2, 200 + D2, 200 + D3, 200 + E1);
+	TEST_CHECK(sm->dcount == 0);
+	TEST_CHECK(hsm_getState(sm) == B);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+// events posted by the unmasked interrupt resume the async dispatcher, which does not poll the queue
+
+#if OS_ATOMICS
+
+static_HSM(sa, 4);
+static_TSK(dsa, 1, NULL);
+
+static volatile unsigned IrqEvents;
+
+static void irq( void )
+{
+	if (IrqEvents > 0 && hsm_giveAsync(sa, E2) == E_SUCCESS)
+		IrqEvents--;
+}
+
+static void test_async( void )
+{
+	unsigned long cnt;
+
+	hsm_startAsync(sa, dsa, A);
+	tsk_sleepFor(1);
+	port_irq = irq;
+
+	cnt = port_cnt;
+	tsk_sleepFor(50);
+	TEST_CHECK(port_cnt - cnt <= 2); // main -> idle -> main
+
+	IrqEvents = 3;
+	tsk_sleepFor(10);
+	TEST_CHECK(IrqEvents == 0);
+	CHECK(100 + E2, 100 + E2, 100 + E2);
+
+	port_irq = NULL;
+	TEST_CHECK(hsm_giveAsync(sa, hsmStop) == E_SUCCESS);
+	tsk_sleepFor(1);
+	TEST_CHECK(hsm_getState(sa) == NULL);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	init();
+	hsm_coalesce(sm, E1);
+	hsm_start(sm, dsp, A);
+	tsk_sleepFor(1);
+	TEST_CHECK(hsm_getState(sm) == A);
+
+	test_coalesce();
+#if OS_HSM_URGENT
+	test_urgent();
+#endif
+#if OS_HSM_DEFER
+	test_defer();
+#endif
+
+	TEST_CHECK(hsm_give(sm, hsmStop) == E_SUCCESS);
+	tsk_sleepFor(1);
+	TEST_CHECK(hsm_getState(sm) == NULL);
+
+#if OS_ATOMICS
+	test_async();
+#endif
+
+	return test_pass(OS_HSM_URGENT ? "hsm" : "hsm_plain");
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,146 @@
+/******************************************************************************
+
+    @file    StateOS: test_libc.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the allocator lock of the gnucc port
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "../port/cortexm/compiler/gnucc/oslibc.c" // access to the allocator lock
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// newlib takes the allocator lock around malloc / free; the host allocator is wrapped in the same way
+
+static void *lib_malloc( size_t size )
+{
+	void *ptr;
+
+	__malloc_lock(NULL);
+	ptr = malloc(size);
+	__malloc_unlock(NULL);
+
+	return ptr;
+}
+
+static void lib_free( void *ptr )
+{
+	__malloc_lock(NULL);
+	free(ptr);
+	__malloc_unlock(NULL);
+}
+
+/* -------------------------------------------------------------------------- */
+// the allocator lock is recursive; interrupts are masked inside it only in the critical section mode
+
+static void nesting( void )
+{
+	__malloc_lock(NULL);
+	TEST_CHECK(port_isr_masked() == !OS_MALLOC_MUTEX);
+	lib_free(lib_malloc(16));
+	TEST_CHECK(port_isr_masked() == !OS_MALLOC_MUTEX);
+	TEST_CHECK(CNT == 1);
+	__malloc_unlock(NULL);
+
+	TEST_CHECK(!port_isr_masked());
+	TEST_CHECK(CNT == 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_MALLOC_MUTEX
+
+// a task holding the allocator is preempted; a higher priority task waits for it (also inside the kernel lock),
+// the holder inherits its priority; memory of objects deleted meanwhile is released when the holder leaves the allocator
+
+static tsk_t *Low;
+static volatile bool Got;
+
+static void low( void )
+{
+	__malloc_lock(NULL);
+	tsk_sleepFor(5);
+	__malloc_unlock(NULL);
+}
+
+static void high( void )
+{
+	void *ptr;
+
+	sys_lock();
+	{
+		ptr = lib_malloc(16);
+	}
+	sys_unlock();
+
+	Got = ptr != NULL;
+	lib_free(ptr);
+}
+
+static void contention( void )
+{
+	Low = tsk_new(1, low);
+	tsk_sleepFor(1);
+	TEST_CHECK(MTX.owner == Low);
+
+	tsk_new(3, high);
+	tsk_sleepFor(1);
+	TEST_CHECK(!Got);
+	TEST_CHECK(Low->prio == 3);
+
+	// the allocator is busy, the release is deferred
+	sem_delete(sem_create(0, semCounting));
+	TEST_CHECK(GBG != NULL);
+
+	tsk_sleepFor(10);
+	TEST_CHECK(Got);
+	TEST_CHECK(GBG == NULL);
+	TEST_CHECK(MTX.owner == NULL && CNT == 0);
+	TEST_CHECK(tsk_join(Low) == E_SUCCESS);
+
+	// the allocator is free, the memory is released at once
+	sem_delete(sem_create(0, semCounting));
+	TEST_CHECK(GBG == NULL && MTX.owner == NULL);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	nesting();
+	#if OS_MALLOC_MUTEX
+	contention();
+	return test_pass("libc_mutex");
+	#else
+	return test_pass("libc");
+	#endif
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,177 @@
+/******************************************************************************
+
+    @file    StateOS: test_msg_packed.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the packed message queue
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <string.h>
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// messages of random lengths are checked against a model fifo; the buffer is not a multiple of the messages,
+// so the packed messages wrap around the end of the buffer
+
+#define STEPS    200000
+#define MSGSIZE  40
+
+static char Buffer[100];
+static msg_t msg[1];
+
+static unsigned char Model[1000];  // the first byte of each message in the model fifo
+static size_t        Length[1000]; // the length of each message in the model fifo
+static unsigned      Head, Tail;
+
+/* -------------------------------------------------------------------------- */
+
+static void check_counters( void )
+{
+	TEST_CHECK(msg_count(msg) <= msg_limit(msg));
+	TEST_CHECK(msg_count(msg) + msg_space(msg) == msg_limit(msg));
+}
+
+static void random_transfers( void )
+{
+	char data[MSGSIZE + 1];
+	size_t size, read;
+	unsigned i, seq = 0;
+	int result;
+
+	for (i = 0; i < STEPS; i++)
+	{
+		size = 1 + test_rand() % MSGSIZE;
+		if (test_rand() % 2)
+		{
+			memset(data, (char)seq, size);
+			result = msg_give(msg, data, size);
+			TEST_CHECK(result == E_SUCCESS || result == E_TIMEOUT);
+			if (result == E_SUCCESS)
+			{
+				Model[Tail % 1000] = (unsigned char)seq++;
+				Length[Tail++ % 1000] = size;
+			}
+		}
+		else
+		{
+			result = msg_take(msg, data, sizeof(data), &read);
+			if (Head == Tail)
+				TEST_CHECK(result == E_TIMEOUT);
+			else
+			{
+				TEST_CHECK(result == E_SUCCESS);
+				TEST_CHECK(read == Length[Head % 1000]);
+				TEST_CHECK((unsigned char)data[0] == Model[Head % 1000]);
+				TEST_CHECK((unsigned char)data[read - 1] == Model[Head % 1000]);
+				Head++;
+			}
+		}
+		check_counters();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+// msg_push drops the oldest messages, but never the last pushed one
+
+static void random_pushes( void )
+{
+	char data[MSGSIZE + 1];
+	size_t size, read;
+	unsigned i, last = 0;
+
+	msg_reset(msg);
+
+	for (i = 0; i < STEPS / 2; i++)
+	{
+		size = 1 + test_rand() % MSGSIZE;
+		memset(data, (char)i, size);
+		TEST_CHECK(msg_push(msg, data, size) == E_SUCCESS);
+		check_counters();
+		if (test_rand() % 5 == 0)
+		{
+			while (msg_take(msg, data, sizeof(data), &read) == E_SUCCESS)
+				last = (unsigned char)data[0];
+			TEST_CHECK(last == (i & 0xFF));
+		}
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+// waiting senders are admitted in order, a shorter message does not overtake them
+
+static void senderA( void ) { TEST_CHECK(msg_send(msg, "AAAAAAAAAAAAAAAAAAAA", 20) == E_SUCCESS); }
+static void senderB( void ) { TEST_CHECK(msg_send(msg, "BB", 2) == E_SUCCESS); }
+
+static void waiting_senders( void )
+{
+	char data[MSGSIZE + 1];
+	size_t read;
+	unsigned full = 0;
+
+	msg_reset(msg);
+	memset(data, 'F', MSGSIZE);
+	while (msg_give(msg, data, MSGSIZE) == E_SUCCESS)
+		full++;
+
+	tsk_new(1, senderA);
+	tsk_new(1, senderB);
+	tsk_sleepFor(1);
+	TEST_CHECK(msg->obj.queue != NULL);
+
+	TEST_CHECK(msg_give(msg, "C", 1) == E_TIMEOUT);
+
+	while (full--)
+	{
+		TEST_CHECK(msg_take(msg, data, sizeof(data), &read) == E_SUCCESS);
+		TEST_CHECK(read == MSGSIZE && data[0] == 'F');
+	}
+	TEST_CHECK(msg->obj.queue == NULL);
+
+	TEST_CHECK(msg_take(msg, data, sizeof(data), &read) == E_SUCCESS);
+	TEST_CHECK(read == 20 && data[0] == 'A');
+	TEST_CHECK(msg_take(msg, data, sizeof(data), &read) == E_SUCCESS);
+	TEST_CHECK(read == 2 && data[0] == 'B');
+	TEST_CHECK(msg_count(msg) == 0);
+
+	tsk_sleepFor(1); // the senders are finished
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	msg_init(msg, MSGSIZE, Buffer, sizeof(Buffer));
+
+	random_transfers();
+	random_pushes();
+	waiting_senders();
+
+	return test_pass("msg_packed");
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,190 @@
+/******************************************************************************
+
+    @file    StateOS: test_mtx_fast.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the mutex fast path
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// port_irq is called at every change of the kernel lock, so it counts the calls of the slow path;
+// the same checks of the mutex semantics pass with and without OS_MUTEX_FAST
+
+static unsigned Locks;
+
+static void irq( void ) { Locks++; }
+
+#if OS_MUTEX_FAST
+#define FAST( call )  (Locks = 0, (call) == E_SUCCESS && Locks == 0)
+#define SLOW( call )  (Locks = 0, (call), Locks > 0)
+#else
+#define FAST( call )  ((call) == E_SUCCESS)
+#define SLOW( call )  ((call), true)
+#endif
+
+static bool held( mtx_t *mtx )
+{
+	mtx_t *lst;
+
+	for (lst = System.cur->mtx.list; lst; lst = lst->list)
+		if (lst == mtx)
+			return true;
+
+	return false;
+}
+
+/* -------------------------------------------------------------------------- */
+// the uncontended mutex is taken and given without the kernel lock and it is not linked to its owner
+
+static void uncontended( void )
+{
+	static mtx_t mtx[1];
+	unsigned i;
+
+	mtx_init(mtx, mtxNormal + mtxPrioInherit, 0);
+
+	for (i = 0; i < 100; i++)
+	{
+		TEST_CHECK(FAST(mtx_take(mtx)));
+		TEST_CHECK(mtx->owner == System.cur);
+		TEST_CHECK(held(mtx) == !OS_MUTEX_FAST);
+		TEST_CHECK(mtx_take(mtx) == E_TIMEOUT);
+		TEST_CHECK(FAST(mtx_give(mtx)));
+		TEST_CHECK(mtx->owner == NULL);
+	}
+
+	// the owner is checked by the slow path only: giving a free error checking mutex fails
+	mtx_init(mtx, mtxErrorCheck, 0);
+	TEST_CHECK(FAST(mtx_lock(mtx)));
+	TEST_CHECK(FAST(mtx_unlock(mtx)));
+	TEST_CHECK(SLOW(TEST_CHECK(mtx_give(mtx) == E_FAILURE)));
+}
+
+/* -------------------------------------------------------------------------- */
+// the first waiter links the mutex to its owner (core_mtx_attach), so the priority is inherited
+// and the mutex is given through the kernel to the waiter
+
+static mtx_t Shared[1];
+static int   Result;
+
+static void waiter( void )
+{
+	Result = mtx_waitFor(Shared, 100);
+	TEST_CHECK(Result != E_SUCCESS || mtx_give(Shared) == E_SUCCESS);
+}
+
+static void contended( void )
+{
+	unsigned prio = tsk_getPrio();
+
+	mtx_init(Shared, mtxNormal + mtxPrioInherit, 0);
+
+	TEST_CHECK(FAST(mtx_lock(Shared)));
+	tsk_new(prio + 2, waiter);
+	tsk_sleepFor(1); // the waiter is blocked on the mutex
+	TEST_CHECK(Shared->obj.queue != NULL);
+	TEST_CHECK(held(Shared));
+	TEST_CHECK(System.cur->prio == prio + 2);
+
+	Result = E_FAILURE;
+	TEST_CHECK(SLOW(mtx_unlock(Shared)));
+	TEST_CHECK(System.cur->prio == prio);
+	TEST_CHECK(!held(Shared));
+	tsk_sleepFor(1); // the waiter got the mutex and released it
+	TEST_CHECK(Result == E_SUCCESS);
+	TEST_CHECK(Shared->owner == NULL);
+
+	// the waiter times out; the mutex stays linked until it is given
+	TEST_CHECK(FAST(mtx_lock(Shared)));
+	tsk_new(prio + 2, waiter);
+	tsk_sleepFor(200);
+	TEST_CHECK(Result == E_TIMEOUT);
+	TEST_CHECK(held(Shared));
+	TEST_CHECK(SLOW(mtx_unlock(Shared)));
+	TEST_CHECK(Shared->owner == NULL && !held(Shared));
+	TEST_CHECK(System.cur->prio == prio);
+	TEST_CHECK(FAST(mtx_lock(Shared)));
+	TEST_CHECK(FAST(mtx_unlock(Shared)));
+}
+
+/* -------------------------------------------------------------------------- */
+// the nested locks of a recursive mutex and the robust mutexes take the slow path
+
+static void owner( void )
+{
+	TEST_CHECK(SLOW(TEST_CHECK(mtx_lock(Shared) == E_SUCCESS)));
+	tsk_sleep(); // the task is killed while holding the mutex
+}
+
+static void slow_paths( void )
+{
+	static mtx_t mtx[1];
+	tsk_t *tsk;
+
+	mtx_init(mtx, mtxRecursive, 0);
+	TEST_CHECK(FAST(mtx_lock(mtx)));
+	TEST_CHECK(SLOW(TEST_CHECK(mtx_lock(mtx) == E_SUCCESS)));
+	TEST_CHECK(mtx->count == 1);
+	TEST_CHECK(SLOW(TEST_CHECK(mtx_unlock(mtx) == E_SUCCESS)));
+	TEST_CHECK(mtx->count == 0 && mtx->owner == System.cur);
+	TEST_CHECK(FAST(mtx_unlock(mtx)));
+	TEST_CHECK(mtx->owner == NULL);
+
+	// the robust mutex is always linked, so it is released when its owner is killed
+	mtx_init(Shared, mtxNormal + mtxRobust, 0);
+	tsk = tsk_new(tsk_getPrio() + 1, owner);
+	tsk_sleepFor(1);
+	TEST_CHECK(Shared->owner == tsk);
+	tsk_kill(tsk);
+	TEST_CHECK(SLOW(TEST_CHECK(mtx_lock(Shared) == OWNERDEAD)));
+	TEST_CHECK(SLOW(TEST_CHECK(mtx_unlock(Shared) == E_SUCCESS)));
+
+	// the priority protected mutex with the ceiling below the caller
+	mtx_init(mtx, mtxPrioProtect, tsk_getPrio() - 1);
+	TEST_CHECK(SLOW(TEST_CHECK(mtx_lock(mtx) == E_FAILURE)));
+	TEST_CHECK(mtx->owner == NULL);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	tsk_setPrio(2);
+	port_irq = irq;
+
+	uncontended();
+	contended();
+	slow_paths();
+
+	port_irq = NULL;
+	return test_pass("mtx_fast");
+}
+
+/* -------------------------------------------------------------------------- */
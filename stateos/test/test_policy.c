@@ -0,0 +1,98 @@
+/******************************************************************************
+
+    @file    StateOS: test_policy.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the scheduling policies
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <string.h>
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// the tasks consume the processor time calling port_tck_handler (the system tick interrupts the task)
+
+#define TICKS     6
+#define QUANTUM   2
+
+static char     Log[2 * TICKS + 1]; // the task running at each tick
+static unsigned LogCount;
+
+static void worker( char id )
+{
+	unsigned i;
+
+	for (i = 0; i < TICKS; i++)
+	{
+		Log[LogCount++] = id;
+		port_tck_handler();
+	}
+}
+
+static void workerA( void ) { worker('A'); }
+static void workerB( void ) { worker('B'); }
+
+/* -------------------------------------------------------------------------- */
+
+static void run( unsigned policy, cnt_t quantum, const char *expected )
+{
+	tsk_t *a, *b;
+
+	LogCount = 0;
+
+	// main has the higher priority while starting the workers, so they are started together when main blocks
+	tsk_prio(2);
+	a = wrk_create(1, workerA, OS_STACK_SIZE, false, false);
+	b = wrk_create(1, workerB, OS_STACK_SIZE, false, false);
+	TEST_CHECK(a != NULL && b != NULL);
+	tsk_setPolicy(a, policy, quantum);
+	tsk_setPolicy(b, policy, quantum);
+	TEST_CHECK(tsk_getPolicy(a) == policy);
+	tsk_start(a);
+	tsk_start(b);
+	tsk_prio(OS_MAIN_PRIO);
+
+	TEST_CHECK(tsk_join(a) == E_SUCCESS);
+	TEST_CHECK(tsk_join(b) == E_SUCCESS);
+
+	Log[LogCount] = '\0';
+	TEST_CHECK(strcmp(Log, expected) == 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	run(tskRR,   QUANTUM, "AABBAABBAABB");
+	run(tskRR,   1,       "ABABABABABAB");
+	run(tskFIFO, QUANTUM, "AAAAAABBBBBB");
+
+	return test_pass("policy");
+}
+
+/* -------------------------------------------------------------------------- */
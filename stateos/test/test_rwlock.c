@@ -0,0 +1,383 @@
+/******************************************************************************
+
+    @file    StateOS: test_rwlock.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the read/write lock policies and the batch wakeup
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// the kernel works in cooperative mode: a woken task does not preempt the main task,
+// the main task checks the state of the objects and lets the other tasks run by sleeping
+
+#define MAX      8
+
+enum { OP_READ, OP_WRITE, OP_UPGRADE, OP_WAIT };
+
+typedef struct
+{
+	unsigned id;
+	int      op;
+	int      result;
+	bool     held;
+	sem_t    go;
+
+}	req_t;
+
+static req_t    Req[MAX];
+static unsigned Order[MAX], OrderCount;
+
+static_RWL(rwl);
+static_SEM(sem, 0);
+
+/* -------------------------------------------------------------------------- */
+
+static void worker( void *arg )
+{
+	req_t *req = arg;
+
+	switch (req->op)
+	{
+	case OP_READ:    req->result = rwl_waitRead(rwl);  break;
+	case OP_WRITE:   req->result = rwl_waitWrite(rwl); break;
+	case OP_UPGRADE: req->result = rwl_waitRead(rwl);
+	                 if (req->result == E_SUCCESS)
+	                     req->result = rwl_upgrade(rwl);
+	                 break;
+	case OP_WAIT:    req->result = sem_wait(sem);      break;
+	}
+
+	req->held = req->result == E_SUCCESS;
+	Order[OrderCount++] = req->id;
+	if (req->op == OP_WAIT || !req->held)
+		return;
+
+	sem_wait(&req->go);
+	if (req->op == OP_READ)
+		rwl_giveRead(rwl);
+	else
+		rwl_giveWrite(rwl);
+	req->held = false;
+}
+
+static req_t *start( unsigned id, unsigned prio, int op )
+{
+	req_t *req = &Req[id];
+
+	req->id = id;
+	req->op = op;
+	req->result = E_FAILURE;
+	req->held = false;
+	sem_init(&req->go, 0, semCounting);
+	TEST_CHECK(tsk_setup(prio, worker, req, OS_STACK_SIZE) != NULL);
+
+	return req;
+}
+
+static void release( req_t *req )
+{
+	sem_give(&req->go);
+	tsk_sleepFor(1);
+	TEST_CHECK(!req->held);
+}
+
+static void setup( unsigned mode )
+{
+	rwl_init(rwl);
+	rwl_setMode(rwl, mode);
+	OrderCount = 0;
+}
+
+/* -------------------------------------------------------------------------- */
+// tasks released by core_num_wakeup are merged into the READY queue in one pass;
+// the READY queue must be the same as after inserting them one by one:
+// ordered by priority, the released tasks follow the ready tasks of the same priority in the order of the blocked queue
+
+static void check_ready( tsk_t *const *expected, unsigned count )
+{
+	tsk_t *tsk = IDLE.hdr.next;
+	unsigned i;
+
+	for (i = 0; i < count; i++, tsk = tsk->hdr.next)
+		TEST_CHECK(tsk == expected[i]);
+	TEST_CHECK(tsk == &IDLE);
+}
+
+static tsk_t *task( unsigned id )
+{
+	tsk_t *tsk;
+
+	for (tsk = IDLE.hdr.next; tsk != &IDLE; tsk = tsk->hdr.next)
+		if (tsk->arg == &Req[id])
+			return tsk;
+	for (tsk = sem->obj.queue; tsk != NULL; tsk = tsk->obj.queue)
+		if (tsk->arg == &Req[id])
+			return tsk;
+
+	return NULL;
+}
+
+static void merge( void )
+{
+	static const unsigned prio[6] = { 2, 3, 2, 1, 3, 2 };
+	tsk_t *expected[9];
+	unsigned i;
+
+	sem_init(sem, 0, semCounting);
+	OrderCount = 0;
+
+	// the waiters block in the order of priority: 1, 4, 0, 2, 5, 3
+	for (i = 0; i < 6; i++)
+		start(i, prio[i], OP_WAIT);
+	tsk_sleepFor(1);
+	TEST_CHECK(OrderCount == 0);
+
+	// ready tasks of the same priorities as the waiters
+	start(6, 3, OP_WAIT);
+	start(7, 2, OP_WAIT);
+
+	// the first two waiters are released
+	TEST_CHECK(sem_release(sem, 2) == E_SUCCESS);
+	expected[0] = task(6);
+	expected[1] = task(1);
+	expected[2] = task(4);
+	expected[3] = task(7);
+	expected[4] = tsk_this();
+	check_ready(expected, 5);
+
+	// all the other waiters are released
+	TEST_CHECK(sem_release(sem, 4) == E_SUCCESS);
+	expected[4] = task(0);
+	expected[5] = task(2);
+	expected[6] = task(5);
+	expected[7] = task(3);
+	expected[8] = tsk_this();
+	check_ready(expected, 9);
+	TEST_CHECK(sem->obj.queue == NULL);
+
+	// the tasks consume two more tokens
+	TEST_CHECK(sem_release(sem, 2) == E_SUCCESS);
+	tsk_sleepFor(1);
+	TEST_CHECK(OrderCount == 8);
+	TEST_CHECK(Order[0] == 6 && Order[1] == 1 && Order[2] == 4 && Order[3] == 7);
+	TEST_CHECK(Order[4] == 0 && Order[5] == 2 && Order[6] == 5 && Order[7] == 3);
+	TEST_CHECK(sem_getValue(sem) == 0);
+}
+
+/* -------------------------------------------------------------------------- */
+// readers waiting for the writer are admitted in one pass
+
+static void batch( void )
+{
+	unsigned i;
+
+	setup(rwlDefault);
+
+	TEST_CHECK(rwl_takeWrite(rwl) == E_SUCCESS);
+	for (i = 0; i < 5; i++)
+		start(i, 1 + i % 3, OP_READ);
+	tsk_sleepFor(1);
+	TEST_CHECK(OrderCount == 0);
+
+	rwl_giveWrite(rwl);
+	TEST_CHECK(rwl->write == false && rwl->count == 5);
+	TEST_CHECK(rwl->queue == NULL);
+
+	// readers run in the order of priority
+	tsk_sleepFor(1);
+	TEST_CHECK(OrderCount == 5);
+	TEST_CHECK(Order[0] == 2 && Order[1] == 1 && Order[2] == 4 && Order[3] == 0 && Order[4] == 3);
+
+	for (i = 0; i < 5; i++)
+		release(&Req[i]);
+	TEST_CHECK(rwl->count == 0);
+}
+
+/* -------------------------------------------------------------------------- */
+// policies: admission of a new reader while a writer is waiting and the handoff of the released writer lock
+
+static void policy( unsigned mode )
+{
+	setup(mode);
+
+	// the writer waits for the reader (main)
+	TEST_CHECK(rwl_takeRead(rwl) == E_SUCCESS);
+	start(0, 1, OP_WRITE);
+	tsk_sleepFor(1);
+	TEST_CHECK(!Req[0].held);
+
+	// a new reader is admitted only in the reader-preferring mode
+	TEST_CHECK(rwl_takeRead(rwl) == (mode == rwlPreferRead ? E_SUCCESS : E_TIMEOUT));
+	if (mode == rwlPreferRead)
+		rwl_giveRead(rwl);
+	rwl_giveRead(rwl);
+	TEST_CHECK(rwl->write == true && rwl->count == 0);
+	tsk_sleepFor(1);
+	TEST_CHECK(Req[0].held);
+
+	// another writer and two readers wait for the writer
+	start(1, 1, OP_READ);
+	start(2, 1, OP_WRITE);
+	start(3, 1, OP_READ);
+	tsk_sleepFor(1);
+	TEST_CHECK(OrderCount == 1);
+
+	release(&Req[0]);
+	if (mode == rwlPhaseFair)
+	{
+		// the waiting readers are admitted first, the writer waits for them
+		TEST_CHECK(Req[1].held && !Req[2].held && Req[3].held);
+		release(&Req[1]);
+		release(&Req[3]);
+		TEST_CHECK(Req[2].held);
+		release(&Req[2]);
+	}
+	else
+	{
+		// the lock is passed to the next writer, then the readers are admitted
+		TEST_CHECK(!Req[1].held && Req[2].held && !Req[3].held);
+		release(&Req[2]);
+		TEST_CHECK(Req[1].held && Req[3].held);
+		release(&Req[1]);
+		release(&Req[3]);
+	}
+
+	TEST_CHECK(OrderCount == 4);
+	TEST_CHECK(rwl->write == false && rwl->count == 0);
+}
+
+/* -------------------------------------------------------------------------- */
+// upgrade waits for the other readers, it takes precedence over the waiting writers
+
+static void upgrade( void )
+{
+	req_t *upg;
+
+	setup(rwlPhaseFair);
+
+	TEST_CHECK(rwl_takeRead(rwl) == E_SUCCESS);
+	upg = start(0, 1, OP_UPGRADE);
+	tsk_sleepFor(1);
+	TEST_CHECK(!upg->held && rwl->upgrd != NULL && rwl->count == 2);
+
+	// another upgrade fails at once, the writer and new readers wait
+	TEST_CHECK(rwl_upgradeFor(rwl, 5) == E_FAILURE);
+	TEST_CHECK(rwl_takeRead(rwl) == E_TIMEOUT);
+	start(1, 1, OP_WRITE);
+	tsk_sleepFor(1);
+	TEST_CHECK(rwl->obj.queue != NULL);
+
+	// the last other reader leaves, the upgrade succeeds
+	rwl_giveRead(rwl);
+	TEST_CHECK(rwl->write == true && rwl->count == 0 && rwl->upgrd == NULL);
+	tsk_sleepFor(1);
+	TEST_CHECK(upg->result == E_SUCCESS && upg->held);
+
+	release(upg);
+	TEST_CHECK(Req[1].held);
+	release(&Req[1]);
+
+	// upgrade times out while another reader holds the lock, the reader lock is still held
+	TEST_CHECK(rwl_takeRead(rwl) == E_SUCCESS);
+	start(2, 1, OP_READ);
+	tsk_sleepFor(1);
+	TEST_CHECK(rwl_upgradeFor(rwl, IMMEDIATE) == E_TIMEOUT);
+	TEST_CHECK(rwl_upgradeFor(rwl, 3) == E_TIMEOUT);
+	TEST_CHECK(rwl->write == false && rwl->count == 2 && rwl->upgrd == NULL);
+	release(&Req[2]);
+
+	// the only reader is upgraded at once
+	TEST_CHECK(rwl_upgradeFor(rwl, IMMEDIATE) == E_SUCCESS);
+	TEST_CHECK(rwl->write == true && rwl->count == 0);
+	rwl_giveWrite(rwl);
+}
+
+/* -------------------------------------------------------------------------- */
+// downgrade admits the waiting readers according to the policy
+
+static void downgrade( unsigned mode )
+{
+	setup(mode);
+
+	TEST_CHECK(rwl_takeWrite(rwl) == E_SUCCESS);
+	start(0, 1, OP_READ);
+	start(1, 1, OP_WRITE);
+	start(2, 1, OP_READ);
+	tsk_sleepFor(1);
+	TEST_CHECK(OrderCount == 0);
+
+	rwl_downgrade(rwl);
+	TEST_CHECK(rwl->write == false);
+	if (mode == rwlPreferRead)
+	{
+		TEST_CHECK(rwl->count == 3);
+		tsk_sleepFor(1);
+		release(&Req[0]);
+		release(&Req[2]);
+	}
+	else
+	{
+		// the readers wait for the writer
+		TEST_CHECK(rwl->count == 1);
+	}
+
+	rwl_giveRead(rwl);
+	tsk_sleepFor(1);
+	TEST_CHECK(Req[1].held);
+	release(&Req[1]);
+	if (mode != rwlPreferRead)
+	{
+		TEST_CHECK(Req[0].held && Req[2].held);
+		release(&Req[0]);
+		release(&Req[2]);
+	}
+
+	TEST_CHECK(OrderCount == 3);
+	TEST_CHECK(rwl->write == false && rwl->count == 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	merge();
+	batch();
+	policy(rwlPreferRead);
+	policy(rwlPreferWrite);
+	policy(rwlPhaseFair);
+	upgrade();
+	downgrade(rwlPreferRead);
+	downgrade(rwlPreferWrite);
+	downgrade(rwlPhaseFair);
+
+	return test_pass("rwlock");
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,88 @@
+/******************************************************************************
+
+    @file    StateOS: test_stack_profile.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the stack profiler records of released tasks
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include <string.h>
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// records of released tasks are merged by the task proc, so they don't exhaust the profiler
+
+#define SPAWNS   100
+
+static void jobA( void *arg ) { (void)arg; }
+static void jobB( void *arg ) { (void)arg; }
+
+static char Report[1024];
+
+/* -------------------------------------------------------------------------- */
+
+static void spawn( fun_a *job )
+{
+	unsigned i;
+	tsk_t *tsk;
+
+	for (i = 0; i < SPAWNS; i++)
+	{
+		tsk = tsk_setup(1, job, NULL, i % 2 ? OS_STACK_SIZE : 2 * OS_STACK_SIZE);
+		TEST_CHECK(tsk != NULL);
+		TEST_CHECK(tsk_join(tsk) == E_SUCCESS);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	size_t len;
+	char *line;
+	unsigned tasks = 0;
+
+	spawn(jobA);
+	spawn(jobB);
+
+	// MAIN, IDLE and one record for each proc of the released tasks
+	TEST_CHECK(StackProfile[2].tsk == NULL && StackProfile[2].proc != NULL);
+	TEST_CHECK(StackProfile[3].tsk == NULL && StackProfile[3].proc != NULL);
+	TEST_CHECK(StackProfile[2].proc != StackProfile[3].proc);
+	TEST_CHECK(StackProfile[2].size == 2 * OS_STACK_SIZE && StackProfile[3].size == 2 * OS_STACK_SIZE);
+
+	len = sys_stackReport(Report, sizeof(Report));
+	TEST_CHECK(len < sizeof(Report));
+	for (line = strstr(Report, "TASK 0x00000000 "); line != NULL; line = strstr(line + 1, "TASK 0x00000000 "))
+		tasks++;
+	TEST_CHECK(tasks == 2);
+
+	return test_pass("stack_profile");
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,134 @@
+/******************************************************************************
+
+    @file    StateOS: test_task_pool.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Test and spawn latency benchmark of the pool of parked workers.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include <time.h>
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// the same test is built without the pool (task_spawn), so the latencies can be compared
+// only the spawn is measured; creation of the emulated host contexts would dominate the switch
+
+#define SPAWNS   10000
+
+static volatile unsigned Count;
+
+#if OS_TASK_POOL
+static tsk_t   *Workers[OS_TASK_POOL];
+static unsigned WorkerCount;
+
+// every task is executed by one of the parked workers
+static void worker( tsk_t *tsk )
+{
+	unsigned i;
+
+	for (i = 0; i < WorkerCount; i++)
+		if (Workers[i] == tsk)
+			return;
+
+	TEST_CHECK(WorkerCount < OS_TASK_POOL);
+	Workers[WorkerCount++] = tsk;
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+static void job( void *arg )
+{
+#if OS_TASK_POOL
+	worker(tsk_this());
+#endif
+	Count += (unsigned)(uintptr_t)arg;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static double now( void )
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	unsigned i;
+	tsk_t *tsk;
+	double t;
+#if OS_TASK_POOL
+	// the number of parked workers is limited by OS_TASK_POOL
+	TEST_CHECK(tsk_reserve(1, OS_STACK_SIZE) == 1);
+	TEST_CHECK(tsk_reserve(1, 2 * OS_STACK_SIZE) == 1);
+	TEST_CHECK(tsk_reserve(OS_TASK_POOL, OS_STACK_SIZE) == OS_TASK_POOL - 2);
+#endif
+
+	// joinable tasks (std::thread, std::async); the worker is parked again when the task is joined
+	for (i = 0, t = 0; i < SPAWNS; i++)
+	{
+		t -= now();
+		tsk = tsk_setup(1, job, (void *)1, i % 2 ? OS_STACK_SIZE : 2 * OS_STACK_SIZE);
+		t += now();
+		TEST_CHECK(tsk != NULL);
+		TEST_CHECK(tsk_join(tsk) == E_SUCCESS);
+#if OS_TASK_POOL
+		TEST_CHECK(tsk->guard != NULL); // the worker has been parked
+#endif
+	}
+	TEST_CHECK(Count == SPAWNS);
+	printf("tsk_setup:  %.0f ns\n", t / SPAWNS);
+
+	// detached tasks; the worker is parked again when the task ends, the idle task (deleter) is not involved
+	tsk_prio(1);
+	for (i = 0, t = 0; i < SPAWNS; i++)
+	{
+		t -= now();
+		TEST_CHECK(tsk_submit(2, job, (void *)2, OS_STACK_SIZE) == E_SUCCESS);
+		t += now();
+		tsk_yield();
+		TEST_CHECK(Count == SPAWNS + 2 * (i + 1));
+#if OS_TASK_POOL
+		TEST_CHECK(IDLE.obj.queue == NULL);
+#endif
+	}
+	tsk_prio(OS_MAIN_PRIO);
+	TEST_CHECK(Count == 3 * SPAWNS);
+	printf("tsk_submit: %.0f ns\n", t / SPAWNS);
+
+#if OS_TASK_POOL
+	return test_pass("task_pool");
+#else
+	return test_pass("task_spawn");
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
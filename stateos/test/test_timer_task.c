@@ -0,0 +1,189 @@
+/******************************************************************************
+
+    @file    StateOS: test_timer_task.c
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   StateOS: host test of the timer service task
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2022 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "os.h"
+#include "test.h"
+
+/* -------------------------------------------------------------------------- */
+// time of the host port advances only when the idle task runs, or when a task calls port_tck_handler;
+// the latter emulates the system tick interrupting the running task (the task consumes the processor time)
+
+static void spin( unsigned ticks )
+{
+	while (ticks--) port_tck_handler();
+}
+
+/* -------------------------------------------------------------------------- */
+// callbacks are executed by the timer service task with interrupts enabled,
+// callbacks of timers selected by tmr_setISR are executed in the interrupt context
+
+static_TMR(tmrTask, NULL);
+static_TMR(tmrISR,  NULL);
+
+static volatile bool   TaskContext, ISRContext;
+static volatile tmr_t *TaskCurrent, *ISRCurrent;
+
+static void procTask( void )
+{
+	TaskContext = !port_isr_context() && !port_isr_masked() && tsk_this()->prio == OS_TIMER_TASK;
+	TaskCurrent = tmr_thisISR();
+}
+
+static void procISR( void )
+{
+	ISRContext = port_isr_context();
+	ISRCurrent = tmr_thisISR();
+}
+
+static void context( void )
+{
+	tmr_setISR(tmrISR, true);
+	tmr_startFrom(tmrTask, 1, 0, procTask);
+	tmr_startFrom(tmrISR,  1, 0, procISR);
+	tsk_sleepFor(2);
+
+	TEST_CHECK(TaskContext && TaskCurrent == tmrTask);
+	TEST_CHECK(ISRContext  && ISRCurrent  == tmrISR);
+}
+
+/* -------------------------------------------------------------------------- */
+// timers expired at the same time are serviced in one batch, in the order of the timer queue
+// (of the timers with the same expiration time, the one started later is the first)
+
+static tmr_t    Batch[3];
+static unsigned Order[3], OrderCount;
+static cnt_t    Time[3];
+
+static void procBatch( void )
+{
+	unsigned id = (unsigned)(tmr_thisISR() - Batch);
+
+	Order[OrderCount] = id;
+	Time[OrderCount++] = sys_time();
+}
+
+static void batch( void )
+{
+	unsigned i;
+
+	for (i = 0; i < 3; i++)
+		tmr_init(&Batch[i], procBatch);
+	tmr_startFor(&Batch[2], 5);
+	tmr_startFor(&Batch[0], 3);
+	tmr_startFor(&Batch[1], 3);
+
+	TEST_CHECK(tmr_wait(&Batch[2]) == E_SUCCESS);
+	TEST_CHECK(OrderCount == 3);
+	TEST_CHECK(Order[0] == 1 && Order[1] == 0 && Order[2] == 2);
+	TEST_CHECK(Time[0] == Time[1] && Time[2] == Time[0] + 2);
+}
+
+/* -------------------------------------------------------------------------- */
+// a slow callback delays neither the interrupt context callbacks nor the system tick;
+// overdue periods of its periodic timer are skipped
+
+#define SLOW_PERIOD  4
+#define SLOW_TIME    6
+
+static_TMR(tmrSlow, NULL);
+
+static volatile unsigned SlowCount, TickCount, SlowTicks;
+static cnt_t             SlowStart;
+
+static void procSlow( void )
+{
+	unsigned ticks = TickCount;
+
+	TEST_CHECK((cnt_t)(sys_time() - SlowStart) % SLOW_PERIOD == 0);
+	spin(SLOW_TIME);
+	SlowTicks += TickCount - ticks;
+	SlowCount++;
+}
+
+static void procTick( void )
+{
+	TickCount++;
+}
+
+static void slow( void )
+{
+	tmr_startFrom(tmrISR, 1, 1, procTick);
+	SlowStart = sys_time();
+	tmr_startFrom(tmrSlow, SLOW_PERIOD, SLOW_PERIOD, procSlow);
+	tsk_sleepFor(SLOW_PERIOD * 10);
+	tmr_reset(tmrSlow);
+	tmr_reset(tmrISR);
+
+	// the callback takes SLOW_TIME ticks, every second period is skipped;
+	// the last callback has delayed the main task, but not the tick
+	TEST_CHECK(SlowCount == 5);
+	TEST_CHECK(SlowTicks == SlowCount * SLOW_TIME);
+	TEST_CHECK(TickCount == sys_time() - SlowStart);
+}
+
+/* -------------------------------------------------------------------------- */
+// a callback can restart or stop its own timer
+
+static_TMR(tmrSelf, NULL);
+
+static volatile unsigned SelfCount;
+
+static void procSelf( void )
+{
+	if (++SelfCount < 3)
+		tmr_startFor(tmrSelf, SelfCount);
+	else
+		tmr_delayISR(0);
+}
+
+static void self( void )
+{
+	tmr_startFrom(tmrSelf, 1, 1, procSelf);
+	tsk_sleepFor(10);
+
+	TEST_CHECK(SelfCount == 3);
+	TEST_CHECK(tmr_take(tmrSelf) == E_SUCCESS);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	context();
+	batch();
+	slow();
+	self();
+
+	return test_pass("timer_task");
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""
+    @file    StateOS: stackprofile.py
+    @author  Rajmund Szymanski
+    @date    19.10.2026
+    @brief   Convert the report of the StateOS stack profiler into a configuration header.
+
+    usage: stackprofile.py [-e ELF] [-n NM] [-o HEADER] [REPORT]
+
+    The report is produced by sys_stackReport (OS_STACK_PROFILE > 0).
+    Task procedures are named using the symbol table of the ELF file (if given).
+    OS_MAIN_STACK sizes the stack of main, unless the port places it (MAIN_TOP).
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+def read_symbols(elf, nm):
+    symbols = {}
+    try:
+        out = subprocess.run([nm, elf], check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as err:
+        sys.exit("stackprofile.py: cannot read symbols of %s: %s" % (elf, err))
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[1] in "tTwW":
+            symbols[int(fields[0], 16) & ~1] = fields[2]
+    return symbols
+
+def read_report(lines):
+    margin, records = None, []
+    for line in lines:
+        match = re.match(r"#.*margin\s+(\d+)%", line)
+        if match:
+            margin = int(match.group(1))
+            continue
+        fields = line.split()
+        if len(fields) != 6 or fields[0] not in ("MAIN", "IDLE", "TASK"):
+            continue
+        kind, tsk, proc = fields[0], int(fields[1], 16), int(fields[2], 16)
+        size, used, recommended = (int(f) for f in fields[3:])
+        records.append((kind, tsk, proc, size, used, recommended))
+    return margin, records
+
+def macro_name(name):
+    return re.sub(r"\W", "_", name).upper()
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert the StateOS stack profile into a configuration header.")
+    parser.add_argument("report", nargs="?", help="report of the stack profiler (default: standard input)")
+    parser.add_argument("-e", "--elf", help="ELF file used to name the task procedures")
+    parser.add_argument("-n", "--nm", default="arm-none-eabi-nm", help="nm tool (default: arm-none-eabi-nm)")
+    parser.add_argument("-o", "--output", help="output header (default: standard output)")
+    args = parser.parse_args()
+
+    if args.report:
+        with open(args.report) as f:
+            margin, records = read_report(f)
+    else:
+        margin, records = read_report(sys.stdin)
+
+    if not records:
+        sys.exit("stackprofile.py: no stack profile records found")
+
+    symbols = read_symbols(args.elf, args.nm) if args.elf else {}
+
+    tasks = {}
+    out = []
+    out.append("/* generated by stackprofile.py from the StateOS stack profile (margin %s%%) */" % (margin if margin is not None else "?"))
+    out.append("")
+    out.append("#ifndef __STACKPROFILE_H")
+    out.append("#define __STACKPROFILE_H")
+    out.append("")
+
+    for kind, tsk, proc, size, used, recommended in records:
+        if kind == "MAIN":
+            out.append("// main stack: %d bytes used" % used)
+            out.append("#define OS_MAIN_STACK   %6d" % recommended)
+        elif kind == "IDLE":
+            out.append("// idle stack: %d of %d bytes used" % (used, size))
+            out.append("#define OS_IDLE_STACK   %6d" % recommended)
+        else:
+            # released tasks (tsk == 0) are named by their proc
+            name = symbols.get(proc & ~1, "TASK_%08X" % (tsk or proc))
+            prev = tasks.get(name)
+            if prev is None or prev[2] < recommended:
+                tasks[name] = (used, size, recommended)
+
+    if tasks:
+        out.append("// default stack: the largest recommended task stack")
+        out.append("#define OS_STACK_SIZE   %6d" % max(t[2] for t in tasks.values()))
+        out.append("")
+        for name in sorted(tasks):
+            used, size, recommended = tasks[name]
+            out.append("// %s: %d of %d bytes used" % (name, used, size))
+            out.append("#define STACK_%-20s %6d" % (macro_name(name), recommended))
+
+    out.append("")
+    out.append("#endif//__STACKPROFILE_H")
+
+    text = "\n".join(out) + "\n"
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+if __name__ == "__main__":
+    main()